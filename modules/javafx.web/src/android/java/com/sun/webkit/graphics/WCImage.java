@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2013, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -40,7 +40,9 @@ public abstract class WCImage /*extends Ref*/ {
 
     public ByteBuffer getPixelBuffer() {return null;}
 
-    protected void drawPixelBuffer() {}
+    protected void setPixelBuffer(ByteBuffer buffer) {}
+
+    protected void drawPixelBuffer(int x, int y, int w, int h) {}
 
 //    public synchronized void setRQ(WCRenderQueue rq) {
 //        this.rq = rq;
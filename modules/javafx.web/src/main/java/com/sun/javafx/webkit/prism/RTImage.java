@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -245,24 +245,48 @@ final class RTImage extends PrismImage implements ResourceFactoryListener {
         return pixelBuffer;
     }
 
-    // This method is called from native [ImageBufferData::update]
+    // This method is called from native [ImageBufferJavaBackend] with the
+    // pixel storage it owns.
+    @Override
+    protected void setPixelBuffer(ByteBuffer buffer) {
+        pixelBuffer = buffer.order(ByteOrder.nativeOrder());
+    }
+
+    // This method is called from native [ImageBufferJavaBackend] when it lets
+    // go of the pixel storage. Uploads already posted from it run first, then
+    // it is freed; after that the pixels are read back from the texture.
+    @Override
+    protected void releasePixelBuffer(ByteBuffer buffer) {
+        pixelBuffer = null;
+        PrismInvoker.invokeOnRenderThread(() -> twkFreePixelBuffer(buffer));
+    }
+
+    // This method is called from native [ImageBufferJavaBackend::update]
     // while lazy painting procedure
     @Override
-    protected void drawPixelBuffer() {
+    protected void drawPixelBuffer(int x, int y, int w, int h) {
+        // The storage may be released before this runs, see releasePixelBuffer()
+        final ByteBuffer pixelBuffer = this.pixelBuffer;
         PrismInvoker.invokeOnRenderThread(new Runnable() {
             public void run() {
+                //A new texture has none of the pixels yet
+                boolean wholeImage = (txt == null);
                 //[g] field can be null if it is the first paint
                 //from synthetic ImageData or if the resource factory is disposed
                 Graphics g = getGraphics();
                 if (g != null && pixelBuffer != null) {
+                    int dx = wholeImage ? 0 : x;
+                    int dy = wholeImage ? 0 : y;
+                    int dw = wholeImage ? width : w;
+                    int dh = wholeImage ? height : h;
                     pixelBuffer.rewind();//critical!
                     Image img = Image.fromByteBgraPreData(
                             pixelBuffer,
                             width,
-                            height);
+                            height).createSubImage(dx, dy, dw, dh);
                     Texture txt = g.getResourceFactory().createTexture(img, Texture.Usage.DEFAULT, Texture.WrapMode.CLAMP_NOT_NEEDED);
-                    g.clear();
-                    g.drawTexture(txt, 0, 0, width, height);
+                    g.setCompositeMode(CompositeMode.SRC);
+                    g.drawTexture(txt, dx, dy, dx + dw, dy + dh, 0, 0, dw, dh);
                     txt.dispose();
                 }
             }
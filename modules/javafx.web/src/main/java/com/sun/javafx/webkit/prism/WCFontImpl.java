@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2019, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -26,6 +26,7 @@
 package com.sun.javafx.webkit.prism;
 
 import com.sun.javafx.font.CharToGlyphMapper;
+import com.sun.javafx.font.CompositeFontResource;
 import com.sun.javafx.font.FontFactory;
 import com.sun.javafx.font.FontResource;
 import com.sun.javafx.font.FontStrike;
@@ -41,6 +42,8 @@ import com.sun.javafx.webkit.prism.WCTextRunImpl;
 import com.sun.prism.GraphicsPipeline;
 import com.sun.webkit.graphics.WCFont;
 import com.sun.webkit.graphics.WCTextRun;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
 import java.util.Arrays;
 import java.util.HashMap;
 import static com.sun.javafx.webkit.prism.TextUtilities.getLayoutBounds;
@@ -111,14 +114,47 @@ final class WCFontImpl extends WCFont {
         return strike;
     }
 
-    @Override public double getGlyphWidth(int glyph) {
-        return getFontStrike().getFontResource().getAdvance(glyph, font.getSize());
+    @Override public void getGlyphWidths(int firstGlyph, ByteBuffer buffer) {
+        buffer.order(ByteOrder.nativeOrder());
+        FontResource fr = getFontStrike().getFontResource();
+        float size = font.getSize();
+        for (int glyph = firstGlyph; buffer.remaining() >= Float.BYTES; glyph++) {
+            buffer.putFloat(fr.getAdvance(glyph, size));
+        }
     }
 
-    @Override public float[] getGlyphBoundingBox(int glyph) {
+    @Override public void getGlyphBoundingBoxes(int firstGlyph, ByteBuffer buffer) {
+        buffer.order(ByteOrder.nativeOrder());
+        FontResource fr = getFontStrike().getFontResource();
+        float size = font.getSize();
         float[] bb = new float[4];
-        bb = getFontStrike().getFontResource().getGlyphBoundingBox(glyph, font.getSize(), bb);
-        return new float[]{bb[0], -bb[3], bb[2], bb[3] - bb[1]};
+        for (int glyph = firstGlyph; buffer.remaining() >= 4 * Float.BYTES; glyph++) {
+            bb = fr.getGlyphBoundingBox(glyph, size, bb);
+            buffer.putFloat(bb[0]);
+            buffer.putFloat(-bb[3]);
+            buffer.putFloat(bb[2]);
+            buffer.putFloat(bb[3] - bb[1]);
+        }
+    }
+
+    @Override public String getFontFile() {
+        FontResource fr = getFontStrike().getFontResource();
+        if (fr instanceof CompositeFontResource) {
+            // Glyph codes passed from WebCore only address the primary slot
+            fr = ((CompositeFontResource) fr).getSlotResource(0);
+        }
+        if (fr == null || fr.isEmbeddedFont()) {
+            return null;
+        }
+        String fileName = fr.getFileName();
+        if (fileName == null) {
+            return null;
+        }
+        String lowerCaseName = fileName.toLowerCase();
+        if (lowerCaseName.endsWith(".ttc") || lowerCaseName.endsWith(".otc")) {
+            return null;
+        }
+        return fileName;
     }
 
     @Override public float getXHeight() {
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2018, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -37,10 +37,12 @@ import com.sun.webkit.graphics.WCGraphicsManager;
 import com.sun.webkit.graphics.WCImage;
 import com.sun.webkit.graphics.WCImageDecoder;
 import com.sun.webkit.graphics.WCImageFrame;
-import java.io.ByteArrayInputStream;
 import java.io.IOException;
 import java.io.InputStream;
-import java.util.Arrays;
+import java.nio.ByteBuffer;
+import java.util.ArrayList;
+import java.util.List;
+import javafx.application.Platform;
 import javafx.concurrent.Service;
 import javafx.concurrent.Task;
 
@@ -50,16 +52,28 @@ final class WCImageDecoderImpl extends WCImageDecoder {
 
     private Service<ImageFrame[]> loader;
 
-    private int imageWidth = 0;
-    private int imageHeight = 0;
+    // Frames are decoded without holding the decoder monitor, so that
+    // queries about the image do not wait for a decode to finish. The
+    // results are published under the monitor, which guards the fields
+    // below unless they are volatile.
+    private volatile int imageWidth = 0;
+    private volatile int imageHeight = 0;
     private ImageFrame[] frames;
     private int frameCount = 0; // keeps frame count when decoded frames are temporarily destroyed
-    private boolean fullDataReceived = false;
+    private volatile boolean fullDataReceived = false;
     private boolean framesDecoded = false; // guards frames from repeated decoding
+    private boolean scalingFailed = false; // scaled decoding is not tried again
     private PrismImage[] images;
-    private volatile byte[] data;
-    private volatile int dataSize = 0;
-    private String fileNameExtension;
+    // Serializes the decoding of the full data by WebKit decoding threads.
+    private final Object fullDecodeLock = new Object();
+    // Views of the encoded data segments, which the native decoder keeps
+    // alive until destroy() returns. Guarded by dataLock, as are all the
+    // reads from them, so that no read is in progress once they are
+    // released.
+    private final Object dataLock = new Object();
+    private final List<ByteBuffer> dataSegments = new ArrayList<>();
+    private boolean dataReleased = false;
+    private volatile String fileNameExtension;
 
     static {
         log = PlatformLogger.getLogger(WCImageDecoderImpl.class.getName());
@@ -80,6 +94,10 @@ final class WCImageDecoderImpl extends WCImageDecoder {
         frames = null;
         images = null;
         framesDecoded = false;
+        synchronized (dataLock) {
+            dataSegments.clear();
+            dataReleased = true;
+        }
     }
 
     @Override protected String getFilenameExtension() {
@@ -90,33 +108,84 @@ final class WCImageDecoderImpl extends WCImageDecoder {
         return imageWidth > 0 && imageHeight > 0;
     }
 
-    @Override protected void addImageData(byte[] dataPortion) {
+    private boolean hasImageData() {
+        synchronized (dataLock) {
+            return !dataSegments.isEmpty();
+        }
+    }
+
+    @Override protected void addImageData(ByteBuffer dataPortion) {
         if (dataPortion != null) {
             fullDataReceived = false;
-            if (data == null) {
-                data = Arrays.copyOf(dataPortion, dataPortion.length * 2);
-                dataSize = dataPortion.length;
-            } else {
-                int newDataSize = dataSize + dataPortion.length;
-                if (newDataSize > data.length) {
-                    resizeDataArray(Math.max(newDataSize, data.length * 2));
+            // The portion is a view of a native data segment, which is
+            // decoded from in place rather than copied.
+            synchronized (dataLock) {
+                if (dataReleased) {
+                    return;
                 }
-                System.arraycopy(dataPortion, 0, data, dataSize, dataPortion.length);
-                dataSize = newDataSize;
+                dataSegments.add(dataPortion.asReadOnlyBuffer());
             }
             // Try to decode the partial data until we get image size.
             if (!imageSizeAvilable()) {
                 loadFrames();
             }
-        } else if (data != null && !fullDataReceived) {
+        } else if (hasImageData() && !fullDataReceived) {
             // null dataPortion means data completion
-            if (data.length > dataSize) {
-                resizeDataArray(dataSize);
-            }
             fullDataReceived = true;
         }
     }
 
+    /**
+     * Reads the data segments received so far. A decoder reading from
+     * the stream fails with an IOException once the segments have been
+     * released.
+     */
+    private final class DataSegmentsInputStream extends InputStream {
+        private final ByteBuffer[] segments;
+        private int index = 0;
+
+        private DataSegmentsInputStream() {
+            synchronized (dataLock) {
+                segments = new ByteBuffer[dataSegments.size()];
+                for (int i = 0; i < segments.length; i++) {
+                    segments[i] = dataSegments.get(i).duplicate();
+                }
+            }
+        }
+
+        @Override public int read() throws IOException {
+            byte[] b = new byte[1];
+            return read(b, 0, 1) == 1 ? b[0] & 0xFF : -1;
+        }
+
+        @Override public int read(byte[] b, int off, int len) throws IOException {
+            if (len == 0) {
+                return 0;
+            }
+            synchronized (dataLock) {
+                if (dataReleased) {
+                    throw new IOException("Image data released");
+                }
+                while (index < segments.length && !segments[index].hasRemaining()) {
+                    index++;
+                }
+                if (index == segments.length) {
+                    return -1;
+                }
+                int n = Math.min(len, segments[index].remaining());
+                segments[index].get(b, off, n);
+                return n;
+            }
+        }
+
+        @Override public int available() {
+            synchronized (dataLock) {
+                return dataReleased || index == segments.length
+                        ? 0 : segments[index].remaining();
+            }
+        }
+    }
+
     private void destroyLoader() {
         if (loader != null) {
             loader.cancel();
@@ -136,7 +205,8 @@ final class WCImageDecoderImpl extends WCImageDecoder {
                 }
             };
             this.loader.valueProperty().addListener((ov, old, frames) -> {
-                if ((frames != null) && (loader != null)) {
+                // Frames decoded from the full data take precedence.
+                if ((frames != null) && (loader != null) && !isFramesDecoded()) {
                     setFrames(frames);
                 }
             });
@@ -146,12 +216,6 @@ final class WCImageDecoderImpl extends WCImageDecoder {
         }
     }
 
-    private void resizeDataArray(int newDataSize) {
-        byte[] newData = new byte[newDataSize];
-        System.arraycopy(data, 0, newData, 0, dataSize);
-        data = newData;
-    }
-
     @Override protected void loadFromResource(String name) {
         if (log.isLoggable(Level.FINE)) {
             log.fine(String.format(
@@ -171,12 +235,16 @@ final class WCImageDecoderImpl extends WCImageDecoder {
         setFrames(loadFrames(in));
     }
 
-    private synchronized ImageFrame[] loadFrames(InputStream in) {
+    private ImageFrame[] loadFrames(InputStream in) {
+        return loadFrames(in, 0, 0);
+    }
+
+    private ImageFrame[] loadFrames(InputStream in, int width, int height) {
         if (log.isLoggable(Level.FINE)) {
-            log.fine(String.format("%X Decoding frames", hashCode()));
+            log.fine(String.format("%X Decoding frames (%dx%d)", hashCode(), width, height));
         }
         try {
-            return ImageStorage.loadAll(in, readerListener, 0, 0, true, 1.0f, false);
+            return ImageStorage.loadAll(in, readerListener, width, height, width == 0, 1.0f, width != 0);
         } catch (ImageStorageException e) {
             return null; // consider image missing
         } finally {
@@ -189,7 +257,7 @@ final class WCImageDecoderImpl extends WCImageDecoder {
     }
 
     private ImageFrame[] loadFrames() {
-        return loadFrames(new ByteArrayInputStream(this.data, 0, this.dataSize));
+        return loadFrames(new DataSegmentsInputStream());
     }
 
     private final ImageLoadListener readerListener = new ImageLoadListener() {
@@ -202,15 +270,17 @@ final class WCImageDecoderImpl extends WCImageDecoder {
                 log.fine(String.format("%X Image size %dx%d",
                         hashCode(), metadata.imageWidth, metadata.imageHeight));
             }
-            // The following lines is a workaround for RT-13475,
-            // because image decoder does not report valid image size
-            if (imageWidth < metadata.imageWidth) {
-                imageWidth = metadata.imageWidth;
-            }
-            if (imageHeight < metadata.imageHeight) {
-                imageHeight = metadata.imageHeight;
+            synchronized (WCImageDecoderImpl.this) {
+                // The following lines is a workaround for RT-13475,
+                // because image decoder does not report valid image size
+                if (imageWidth < metadata.imageWidth) {
+                    imageWidth = metadata.imageWidth;
+                }
+                if (imageHeight < metadata.imageHeight) {
+                    imageHeight = metadata.imageHeight;
+                }
+                fileNameExtension = l.getFormatDescription().getExtensions().get(0);
             }
-            fileNameExtension = l.getFormatDescription().getExtensions().get(0);
         }
     };
 
@@ -261,14 +331,28 @@ final class WCImageDecoderImpl extends WCImageDecoder {
         // be any performance degrade while initiating a
         // full decode.
         if (fullDataReceived) {
+            if (!isFramesDecoded() && isSingleFrameFormat()) {
+                // Leave the decoding to getFrame()/getScaledFrame(),
+                // which may not need the full size image.
+                return 1;
+            }
             getImageFrame(0);
         }
-        return frameCount;
+        synchronized (this) {
+            return frameCount;
+        }
     }
 
-    // Avoid redundant decoding by async decoder threads, currently we don't
-    // support per frame decoding.
-    @Override protected synchronized WCImageFrame getFrame(int idx) {
+    private synchronized boolean isFramesDecoded() {
+        return framesDecoded;
+    }
+
+    // Only GIF images can have more than one frame.
+    private boolean isSingleFrameFormat() {
+        return fileNameExtension != null && !"gif".equalsIgnoreCase(fileNameExtension);
+    }
+
+    @Override protected WCImageFrame getFrame(int idx) {
         ImageFrame frame = getImageFrame(idx);
         if (frame != null) {
             if (log.isLoggable(Level.FINE)) {
@@ -285,6 +369,34 @@ final class WCImageDecoderImpl extends WCImageDecoder {
         return null;
     }
 
+    // Whether getScaledFrame() decodes the frame at the requested size
+    // rather than returning the full size frame.
+    private synchronized boolean canScaleFrame(int idx, int width, int height) {
+        return idx == 0 && fullDataReceived && isSingleFrameFormat() && !scalingFailed
+                && width < imageWidth && height < imageHeight;
+    }
+
+    @Override protected WCImageFrame getScaledFrame(int idx, int width, int height) {
+        if (!canScaleFrame(idx, width, height)) {
+            return getFrame(idx);
+        }
+        // The JPEG loader lets libjpeg scale while decoding, other formats
+        // are scaled line by line, so the full size image is never held.
+        ImageFrame[] scaled = loadFrames(new DataSegmentsInputStream(), width, height);
+        if (scaled == null || scaled.length == 0 || scaled[0] == null) {
+            // Also the case when the decoder was destroyed meanwhile.
+            synchronized (this) {
+                scalingFailed = true;
+            }
+            return getFrame(idx);
+        }
+        if (log.isLoggable(Level.FINE)) {
+            log.fine(String.format("%X getScaledFrame(%d): %dx%d",
+                    hashCode(), idx, width, height));
+        }
+        return new Frame(new WCImageImpl(scaled[0]), fileNameExtension);
+    }
+
     private synchronized ImageMetadata getFrameMetadata(int idx) {
         return frames != null && frames.length > idx && frames[idx] != null ? frames[idx].getMetadata() : null;
     }
@@ -317,27 +429,82 @@ final class WCImageDecoderImpl extends WCImageDecoder {
         return size;
     }
 
+    @Override protected int[] getScaledFrameSize(int idx, int width, int height) {
+        if (!canScaleFrame(idx, width, height)) {
+            return getFrameSize(idx);
+        }
+        final int[] size = THREAD_LOCAL_SIZE_ARRAY.get();
+        size[0] = width;
+        size[1] = height;
+        return size;
+    }
+
     @Override protected synchronized boolean getFrameCompleteStatus(int idx) {
         // For GIF images there is no better way to find whether a given frame
         // is completely decoded or not. As of now relying on framesDecoded
         // which will wait for all the frames to decode.
+        if (!framesDecoded && fullDataReceived && isSingleFrameFormat()) {
+            // All the data of the only frame is there, whether or not
+            // it has been decoded at full size.
+            return idx == 0;
+        }
         return getFrameMetadata(idx) != null && framesDecoded;
     }
 
-    private synchronized ImageFrame getImageFrame(int idx) {
+    private ImageFrame getImageFrame(int idx) {
         if (!fullDataReceived) {
-            startLoader();
-        } else if (fullDataReceived && !framesDecoded) {
-            destroyLoader();
-            setFrames(loadFrames()); // re-decode frames if they have been destroyed
-            framesDecoded = true;
-        }
-        return (idx >= 0) && (this.frames != null) && (this.frames.length > idx)
-                ? this.frames[idx]
-                : null;
+            if (Platform.isFxApplicationThread()) {
+                startLoader();
+            } else {
+                // Called from a WebKit asynchronous image decoding thread,
+                // which can decode the partial data itself.
+                ImageFrame[] partialFrames = loadFrames();
+                synchronized (this) {
+                    // Frames decoded from the full data take precedence.
+                    if (!framesDecoded) {
+                        setFrames(partialFrames);
+                    }
+                }
+            }
+        } else if (!isFramesDecoded()) {
+            if (Platform.isFxApplicationThread()) {
+                destroyLoader();
+            } else {
+                Platform.runLater(this::destroyLoader);
+            }
+            // Avoid redundant decoding by async decoder threads, currently
+            // we don't support per frame decoding.
+            synchronized (fullDecodeLock) {
+                if (!isFramesDecoded()) {
+                    // re-decode frames if they have been destroyed
+                    ImageFrame[] decodedFrames = loadFrames();
+                    synchronized (this) {
+                        if (!isDataReleased()) {
+                            setFrames(decodedFrames);
+                            framesDecoded = true;
+                        }
+                    }
+                }
+            }
+        }
+        synchronized (this) {
+            return (idx >= 0) && (this.frames != null) && (this.frames.length > idx)
+                    ? this.frames[idx]
+                    : null;
+        }
+    }
+
+    private boolean isDataReleased() {
+        synchronized (dataLock) {
+            return dataReleased;
+        }
     }
 
     private synchronized PrismImage getPrismImage(int idx, ImageFrame frame) {
+        if (this.frames == null || this.frames.length <= idx) {
+            // Destroyed while the frame was being decoded.
+            return new WCImageImpl(frame);
+        }
         if (this.images == null) {
             this.images = new PrismImage[this.frames.length];
         }
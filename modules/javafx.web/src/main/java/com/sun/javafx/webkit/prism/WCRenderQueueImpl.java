@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2015, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -28,23 +28,50 @@ package com.sun.javafx.webkit.prism;
 import com.sun.webkit.graphics.WCGraphicsContext;
 import com.sun.webkit.graphics.WCRectangle;
 import com.sun.webkit.graphics.WCRenderQueue;
+import java.util.concurrent.atomic.AtomicBoolean;
 
 final class WCRenderQueueImpl extends WCRenderQueue {
 
-    WCRenderQueueImpl(WCGraphicsContext gc) {
+    // Size of the undecoded drawing above which the event thread waits for
+    // the render thread to catch up, rather than queueing more of it.
+    private static final int MAX_PENDING_SIZE = 4 * MAX_QUEUE_SIZE;
+
+    // A scheduled decode drains every buffer queued by the time it runs,
+    // so there is never a need for more than one.
+    private final AtomicBoolean decodePending = new AtomicBoolean();
+
+    // Decodes are coalesced and throttled only along with the deferred
+    // canvas drawing they are meant for (see WebPage).
+    private final boolean defersDrawing;
+
+    WCRenderQueueImpl(WCGraphicsContext gc, boolean defersDrawing) {
         super(gc);
+        this.defersDrawing = defersDrawing;
     }
 
     WCRenderQueueImpl(WCRectangle clip, boolean opaque) {
         super(clip, opaque);
+        this.defersDrawing = false;
     }
 
     @Override
     protected void flush() {
-        if (!isEmpty()) {
+        if (isEmpty()) {
+            return;
+        }
+        if (!defersDrawing) {
             PrismInvoker.invokeOnRenderThread(() -> {
                 decode();
             });
+        } else if (decodePending.compareAndSet(false, true)) {
+            PrismInvoker.invokeOnRenderThread(() -> {
+                decodePending.set(false);
+                decode();
+            });
+        } else if (getSize() > MAX_PENDING_SIZE) {
+            PrismInvoker.runOnRenderThread(() -> {
+                decode();
+            });
         }
     }
 
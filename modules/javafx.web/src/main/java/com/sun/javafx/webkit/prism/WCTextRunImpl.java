@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018, 2019, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2018, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -28,6 +28,8 @@ package com.sun.javafx.webkit.prism;
 import com.sun.javafx.scene.text.GlyphList;
 import com.sun.javafx.text.TextRun;
 import com.sun.webkit.graphics.WCTextRun;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
 
 public final class WCTextRunImpl implements WCTextRun {
     private final TextRun run;
@@ -47,21 +49,16 @@ public final class WCTextRunImpl implements WCTextRun {
     }
 
     @Override
-    public int getGlyph(int index) {
-        return index < run.getGlyphCount() ? run.getGlyphCode(index) : 0;
-    }
-
-    // Avoid repeated allocation
-    private static float POS_AND_ADVANCE[] = new float[4];
-
-    @Override
-    public float[] getGlyphPosAndAdvance(int glyphIndex) {
-        POS_AND_ADVANCE[0] = run.getPosX(glyphIndex);
-        POS_AND_ADVANCE[1] = run.getPosY(glyphIndex);
-        POS_AND_ADVANCE[2] = run.getAdvance(glyphIndex);
-        // FIXME: We don't yet support Y advance from prism.
-        POS_AND_ADVANCE[3] = 0;
-        return POS_AND_ADVANCE;
+    public void getGlyphData(ByteBuffer buffer) {
+        buffer.order(ByteOrder.nativeOrder());
+        int count = run.getGlyphCount();
+        for (int i = 0; i < count; i++) {
+            buffer.putInt(run.getGlyphCode(i));
+            buffer.putInt(run.getCharOffset(i));
+            buffer.putFloat(run.getPosX(i));
+            buffer.putFloat(run.getPosY(i));
+            buffer.putFloat(run.getAdvance(i));
+        }
     }
 
     @Override
@@ -73,9 +70,4 @@ public final class WCTextRunImpl implements WCTextRun {
     public int getEnd() {
         return run.getEnd();
     }
-
-    @Override
-    public int getCharOffset(int index) {
-        return run.getCharOffset(index);
-    }
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2021, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -25,8 +25,10 @@
 
 package com.sun.webkit;
 
+import java.lang.annotation.Annotation;
 import java.lang.reflect.InvocationTargetException;
 import java.lang.reflect.Method;
+import java.lang.reflect.Modifier;
 import java.security.AccessControlContext;
 import java.security.AccessController;
 import java.security.PrivilegedActionException;
@@ -100,6 +102,58 @@ public abstract class Utilities {
         "sun.misc"
     );
 
+    private static boolean isRejected(Class<?> clazz) {
+        final String className = clazz.getName();
+        if (classesRejectList.contains(className)) {
+            return true;
+        }
+        for (String packageName : packagesRejectList) {
+            if (className.startsWith(packageName + ".")) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    private static boolean isCallerSensitive(Method method) {
+        for (Annotation annotation : method.getDeclaredAnnotations()) {
+            if (annotation.annotationType().getName().equals(
+                    "jdk.internal.reflect.CallerSensitive")) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * Returns whether the bridge may call the given method through JNI
+     * instead of fwkInvokeWithContext. This is only the case when the call
+     * would be checked to no effect: no security manager is installed, and
+     * the method is public, declared by a public class in an unconditionally
+     * exported package, and not on the reject lists above. Caller sensitive
+     * methods are excluded too, since called through JNI they would not see
+     * this class as their caller.
+     */
+    @SuppressWarnings("removal")
+    private static boolean fwkCanInvokeDirectly(final Method method) {
+        if (System.getSecurityManager() != null) {
+            return false;
+        }
+        final Class<?> clazz = method.getDeclaringClass();
+        if (clazz.equals(java.lang.Class.class) || isRejected(clazz)
+                || isCallerSensitive(method)) {
+            return false;
+        }
+        return Modifier.isPublic(method.getModifiers())
+                && Modifier.isPublic(clazz.getModifiers())
+                && clazz.getModule().isExported(clazz.getPackageName());
+    }
+
+    @SuppressWarnings("removal")
+    private static boolean fwkIsSecurityManagerInstalled() {
+        return System.getSecurityManager() != null;
+    }
+
     @SuppressWarnings("removal")
     private static Object fwkInvokeWithContext(final Method method,
                                                final Object instance,
@@ -115,18 +169,9 @@ public abstract class Utilities {
             if (!classMethodsAllowList.contains(method.getName())) {
                 throw new UnsupportedOperationException("invocation not supported");
             }
-        } else {
-            // check list of rejected class names
-            final String className = clazz.getName();
-            if (classesRejectList.contains(className)) {
-                throw new UnsupportedOperationException("invocation not supported");
-            }
-            // check list of rejected packages
-            packagesRejectList.forEach(packageName -> {
-                if (className.startsWith(packageName + ".")) {
-                    throw new UnsupportedOperationException("invocation not supported");
-                }
-            });
+        } else if (isRejected(clazz)) {
+            // check lists of rejected classes and packages
+            throw new UnsupportedOperationException("invocation not supported");
         }
 
         try {
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -130,6 +130,10 @@ public final class WebPage {
     // An ID of the current updateContent cycle associated with an updateContent call.
     private int updateContentCycleID;
 
+    // Whether canvas drawing is recorded natively and only handed to the
+    // render thread when the canvas is used.
+    private static boolean defersCanvasDrawing;
+
     static {
         @SuppressWarnings("removal")
         var dummy = AccessController.doPrivileged((PrivilegedAction<Void>) () -> {
@@ -158,6 +162,39 @@ public final class WebPage {
             // Initialize WTF, WebCore and JavaScriptCore.
             twkInitWebCore(useJIT, useDFGJIT, useCSS3D);
 
+            // Capacity of the tile cache shared by all pages, in megabytes.
+            final Integer tileCacheSize = Integer.getInteger(
+                    "com.sun.webkit.tileCacheSize");
+            if (tileCacheSize != null) {
+                TileCache.setCapacity(Math.max(tileCacheSize, 0) * 1024L * 1024L);
+            }
+
+            defersCanvasDrawing = Boolean.getBoolean(
+                    "com.sun.webkit.deferCanvasDrawing");
+            twkSetDefersCanvasDrawing(defersCanvasDrawing);
+
+            // Directory the bytecode of loaded scripts is cached in, if any.
+            final String bytecodeCacheDirectory = System.getProperty(
+                    "com.sun.webkit.bytecodeCacheDirectory");
+            if (bytecodeCacheDirectory != null && !bytecodeCacheDirectory.isEmpty()) {
+                twkSetBytecodeCacheDirectory(bytecodeCacheDirectory);
+            }
+
+            // Size of the tiles composited layers are painted in, in pixels.
+            final Integer layerTileSize = Integer.getInteger(
+                    "com.sun.webkit.layerTileSize");
+            if (layerTileSize != null && layerTileSize > 0) {
+                twkSetLayerTileSize(layerTileSize);
+            }
+
+            // Version of the encoding of drawing commands sent to the render
+            // thread (see GraphicsDecoder.ENCODING_VERSION).
+            final Integer renderQueueEncodingVersion = Integer.getInteger(
+                    "com.sun.webkit.renderQueueEncodingVersion");
+            if (renderQueueEncodingVersion != null) {
+                twkSetRenderQueueEncodingVersion(renderQueueEncodingVersion);
+            }
+
             // Inform the native webkit code when either the JVM or the
             // JavaFX runtime is being shutdown
             final Runnable shutdownHook = () -> {
@@ -1507,6 +1544,14 @@ public final class WebPage {
 
     public void setFontSmoothingType(int fontSmoothingType) {
         this.fontSmoothingType = fontSmoothingType;
+        lockPage();
+        try {
+            if (!isDisposed) {
+                twkSetFontSmoothingType(getPage(), fontSmoothingType);
+            }
+        } finally {
+            unlockPage();
+        }
         repaintAll();
     }
 
@@ -2144,6 +2189,22 @@ public final class WebPage {
         }
     }
 
+    // rects holds x, y, width and height of each rect
+    private void fwkRepaintRects(int[] rects) {
+        lockPage();
+        try {
+            for (int i = 0; i + 3 < rects.length; i += 4) {
+                if (paintLog.isLoggable(Level.FINEST)) {
+                    paintLog.finest("x: {0}, y: {1}, w: {2}, h: {3}",
+                            new Object[] {rects[i], rects[i + 1], rects[i + 2], rects[i + 3]});
+                }
+                addDirtyRect(new WCRectangle(rects[i], rects[i + 1], rects[i + 2], rects[i + 3]));
+            }
+        } finally {
+            unlockPage();
+        }
+    }
+
     private void fwkScroll(int x, int y, int w, int h, int deltaX, int deltaY) {
         if (paintLog.isLoggable(Level.FINEST)) {
             paintLog.finest("Scroll: " + x + " " + y + " " + w + " " + h + "  " + deltaX + " " + deltaY);
@@ -2509,6 +2570,15 @@ public final class WebPage {
         return result;
     }
 
+    /**
+     * Returns whether canvas drawing is handed to the render thread only
+     * when the canvas is used, as set by the
+     * {@code com.sun.webkit.deferCanvasDrawing} property.
+     */
+    public static boolean defersCanvasDrawing() {
+        return defersCanvasDrawing;
+    }
+
     // ---- DumpRenderTree support ---- //
 
     public static int getWorkerThreadCount() {
@@ -2562,11 +2632,117 @@ public final class WebPage {
         return frames.size();
     }
 
+    // Package scope method for testing
+    static void test_setRenderQueueEncodingVersion(int version) {
+        twkSetRenderQueueEncodingVersion(version);
+    }
+
+    // Package scope method for testing
+    static void test_setDefersCanvasDrawing(boolean defers) {
+        defersCanvasDrawing = defers;
+        twkSetDefersCanvasDrawing(defers);
+    }
+
+    // Package scope method for testing
+    int test_getCanvasFlushedBufferCount(String id) {
+        return twkGetCanvasFlushedBufferCount(getPage(), id);
+    }
+
+    // Package scope method for testing
+    void test_setDefersLoading(boolean defers) {
+        twkSetDefersLoading(getPage(), defers);
+    }
+
+    // Package scope method for testing
+    static int test_getCachedJavaClassCount(String className) {
+        return twkGetCachedJavaClassCount(className);
+    }
+
+    // Package scope method for testing
+    static void test_setBytecodeCacheDirectory(String path) {
+        twkSetBytecodeCacheDirectory(path);
+    }
+
+    // Package scope method for testing
+    static int test_getLoadedBytecodeCacheCount() {
+        return twkGetLoadedBytecodeCacheCount();
+    }
+
+    // Package scope method for testing
+    static void test_purgeMemoryCache() {
+        twkPurgeMemoryCache();
+    }
+
+    // Package scope methods for testing the native file system access
+    static String[] test_listDirectory(String path) {
+        return twkListDirectory(path);
+    }
+
+    static boolean test_deleteNonEmptyDirectory(String path) {
+        return twkDeleteNonEmptyDirectory(path);
+    }
+
+    static boolean test_moveFile(String oldPath, String newPath) {
+        return twkMoveFile(oldPath, newPath);
+    }
+
+    static boolean test_copyFile(String targetPath, String sourcePath) {
+        return twkCopyFile(targetPath, sourcePath);
+    }
+
+    static boolean test_hardLinkOrCopyFile(String targetPath, String linkPath) {
+        return twkHardLinkOrCopyFile(targetPath, linkPath);
+    }
+
+    static byte[] test_mapFile(String path) {
+        return twkMapFile(path);
+    }
+
+    static String test_openTemporaryFile(String prefix, String directory, byte[] data) {
+        return twkOpenTemporaryFile(prefix, directory, data);
+    }
+
+    // Package scope method for testing
+    int test_getRenderQueueSize(int x, int y, int w, int h) {
+        final WCRenderQueue rq = WCGraphicsManager.getGraphicsManager().
+                createRenderQueue(new WCRectangle(x, y, w, h), true);
+        twkPrePaint(getPage());
+        twkUpdateContent(getPage(), rq, x, y, w, h);
+        final int size = rq.getSize();
+        rq.dispose();
+        return size;
+    }
+
+    // Package scope method for testing
+    int test_getElidedCommandCount() {
+        return twkGetElidedCommandCount(getPage());
+    }
+
+    // Package scope method for testing
+    WCRectangle test_getAnimatedLayersDirtyRect() {
+        int[] rect = twkGetAnimatedLayersDirtyRect(getPage());
+        return new WCRectangle(rect[0], rect[1], rect[2], rect[3]);
+    }
+
     // *************************************************************************
     // Native methods
     // *************************************************************************
 
     private static native void twkInitWebCore(boolean useJIT, boolean useDFGJIT, boolean useCSS3D);
+    private static native void twkSetLayerTileSize(int size);
+    private static native void twkSetDefersCanvasDrawing(boolean defers);
+    private static native void twkSetBytecodeCacheDirectory(String path);
+    private static native int twkGetLoadedBytecodeCacheCount();
+    private static native void twkPurgeMemoryCache();
+    private static native void twkSetRenderQueueEncodingVersion(int version);
+    private static native int twkGetCachedJavaClassCount(String className);
+    private static native String[] twkListDirectory(String path);
+    private static native boolean twkDeleteNonEmptyDirectory(String path);
+    private static native boolean twkMoveFile(String oldPath, String newPath);
+    private static native boolean twkCopyFile(String targetPath, String sourcePath);
+    private static native boolean twkHardLinkOrCopyFile(String targetPath, String linkPath);
+    private static native byte[] twkMapFile(String path);
+    private static native String twkOpenTemporaryFile(String prefix, String directory, byte[] data);
     private native long twkCreatePage(boolean editable);
     private native void twkInit(long pPage, boolean usePlugins, float devicePixelScale);
     private native void twkDestroyPage(long pPage);
@@ -2626,6 +2802,11 @@ public final class WebPage {
     private native void twkSetBounds(long pPage, int x, int y, int w, int h);
     private native void twkPrePaint(long pPage);
     private native void twkUpdateContent(long pPage, WCRenderQueue rq, int x, int y, int w, int h);
+    private native int twkGetElidedCommandCount(long pPage);
+    private native int twkGetCanvasFlushedBufferCount(long pPage, String id);
+    private native void twkSetDefersLoading(long pPage, boolean defers);
+    private native int[] twkGetAnimatedLayersDirtyRect(long pPage);
+    private native void twkSetFontSmoothingType(long pPage, int fontSmoothingType);
     private native void twkUpdateRendering(long pPage);
     private native void twkPostPaint(long pPage, WCRenderQueue rq,
                                      int x, int y, int w, int h);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2021, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -46,7 +46,6 @@ public final class GraphicsDecoder  {
     @Native public final static int TRANSLATE              = 11;
     @Native public final static int SAVESTATE              = 12;
     @Native public final static int RESTORESTATE           = 13;
-    @Native public final static int CLIP_PATH              = 14;
     @Native public final static int SETCLIP_IIII           = 15;
     @Native public final static int DRAWRECT               = 16;
     @Native public final static int SETCOMPOSITE           = 17;
@@ -56,8 +55,6 @@ public final class GraphicsDecoder  {
     @Native public final static int SETALPHA               = 21;
     @Native public final static int BEGINTRANSPARENCYLAYER = 22;
     @Native public final static int ENDTRANSPARENCYLAYER   = 23;
-    @Native public final static int STROKE_PATH            = 24;
-    @Native public final static int FILL_PATH              = 25;
     @Native public final static int GETIMAGE               = 26;
     @Native public final static int SCALE                  = 27;
     @Native public final static int SETSHADOW              = 28;
@@ -86,6 +83,25 @@ public final class GraphicsDecoder  {
     @Native public final static int SET_MITER_LIMIT        = 54;
     @Native public final static int SET_TEXT_MODE          = 55;
     @Native public final static int SET_PERSPECTIVE_TRANSFORM = 56;
+    // Variants of the commands above carrying the color packed into a single
+    // ARGB int instead of four floats (see getPackedColor).
+    @Native public final static int FILLRECT_FFFFP         = 57;
+    @Native public final static int SETFILLCOLOR_PACKED    = 58;
+    @Native public final static int SETSTROKECOLOR_PACKED  = 59;
+    // Path commands carry the path segments inline (see WCPath.addSegments).
+    @Native public final static int FILL_PATH_SEGMENTS     = 60;
+    @Native public final static int STROKE_PATH_SEGMENTS   = 61;
+    @Native public final static int CLIP_PATH_SEGMENTS     = 62;
+    @Native public final static int SET_FONT_SMOOTHING_TYPE = 63;
+
+    // Versions of the command encoding. The decoder understands all of them;
+    // the native side emits the one set with WebPage's
+    // com.sun.webkit.renderQueueEncodingVersion property.
+    // Version 1 sends every color as four floats.
+    @Native public final static int ENCODING_VERSION_FLOAT_COLORS  = 1;
+    // Version 2 sends 8-bit sRGB colors packed (see getPackedColor).
+    @Native public final static int ENCODING_VERSION_PACKED_COLORS = 2;
+    @Native public final static int ENCODING_VERSION = ENCODING_VERSION_PACKED_COLORS;
 
     private final static PlatformLogger log =
             PlatformLogger.getLogger(GraphicsDecoder.class.getName());
@@ -129,6 +145,14 @@ public final class GraphicsDecoder  {
                         buf.getFloat(), buf.getFloat(), buf.getFloat(), buf.getFloat(),
                         getColor(buf));
                     break;
+                case FILLRECT_FFFFP:
+                    gc.fillRect(
+                        buf.getFloat(),
+                        buf.getFloat(),
+                        buf.getFloat(),
+                        buf.getFloat(),
+                        getPackedColor(buf));
+                    break;
                 case CLEARRECT_FFFF:
                     gc.clearRect(
                         buf.getFloat(),
@@ -147,6 +171,9 @@ public final class GraphicsDecoder  {
                 case SETFILLCOLOR:
                     gc.setFillColor(getColor(buf));
                     break;
+                case SETFILLCOLOR_PACKED:
+                    gc.setFillColor(getPackedColor(buf));
+                    break;
                 case SET_TEXT_MODE:
                     gc.setTextMode(getBoolean(buf), getBoolean(buf), getBoolean(buf));
                     break;
@@ -156,6 +183,9 @@ public final class GraphicsDecoder  {
                 case SETSTROKECOLOR:
                     gc.setStrokeColor(getColor(buf));
                     break;
+                case SETSTROKECOLOR_PACKED:
+                    gc.setStrokeColor(getPackedColor(buf));
+                    break;
                 case SETSTROKEWIDTH:
                     gc.setStrokeWidth(buf.getFloat());
                     break;
@@ -226,9 +256,9 @@ public final class GraphicsDecoder  {
                 case RESTORESTATE:
                     gc.restoreState();
                     break;
-                case CLIP_PATH:
+                case CLIP_PATH_SEGMENTS:
                     gc.setClip(
-                        getPath(gm, buf),
+                        getPathSegments(gm, buf),
                         buf.getInt()>0);
                     break;
                 case SETCLIP_IIII:
@@ -281,11 +311,11 @@ public final class GraphicsDecoder  {
                 case ENDTRANSPARENCYLAYER:
                     gc.endTransparencyLayer();
                     break;
-                case STROKE_PATH:
-                    gc.strokePath(getPath(gm, buf));
+                case STROKE_PATH_SEGMENTS:
+                    gc.strokePath(getPathSegments(gm, buf));
                     break;
-                case FILL_PATH:
-                    gc.fillPath(getPath(gm, buf));
+                case FILL_PATH_SEGMENTS:
+                    gc.fillPath(getPathSegments(gm, buf));
                     break;
                 case SETSHADOW:
                     gc.setShadow(
@@ -302,14 +332,17 @@ public final class GraphicsDecoder  {
                         buf.getInt(), buf.getInt(),     // from and to positions
                         buf.getFloat(), buf.getFloat());// (x,y) position
                     break;
-                case DRAWSTRING_FAST:
+                case DRAWSTRING_FAST: {
+                    WCFont font = (WCFont) gm.getRef(buf.getInt());
+                    int glyphCount = buf.getInt();
                     gc.drawString(
-                        (WCFont) gm.getRef(buf.getInt()),
-                        bdata.getIntArray(buf.getInt()), //glyphs
-                        bdata.getFloatArray(buf.getInt()), //offsets
+                        font,
+                        getIntArray(buf, glyphCount),   // glyphs
+                        getFloatArray(buf, glyphCount), // advances
                         buf.getFloat(),
                         buf.getFloat());
                     break;
+                }
                 case DRAWWIDGET:
                     gc.drawWidget((RenderTheme)(gm.getRef(buf.getInt())),
                         gm.getRef(buf.getInt()), buf.getInt(), buf.getInt());
@@ -349,6 +382,9 @@ public final class GraphicsDecoder  {
                     buffer.copyArea(buf.getInt(), buf.getInt(), buf.getInt(), buf.getInt(),
                                     buf.getInt(), buf.getInt());
                     break;
+                case SET_FONT_SMOOTHING_TYPE:
+                    gc.setFontSmoothingType(buf.getInt());
+                    break;
                 case DECODERQ:
                     WCRenderQueue _rq = (WCRenderQueue)gm.getRef(buf.getInt());
                     _rq.decode(gc.getFontSmoothingType());
@@ -460,12 +496,33 @@ public final class GraphicsDecoder  {
         return array;
     }
 
+    private static int[] getIntArray(ByteBuffer buf, int length) {
+        int[] array = new int[length];
+        buf.asIntBuffer().get(array);
+        buf.position(buf.position() + length * Integer.BYTES);
+        return array;
+    }
+
+    private static float[] getFloatArray(ByteBuffer buf, int length) {
+        float[] array = new float[length];
+        buf.asFloatBuffer().get(array);
+        buf.position(buf.position() + length * Float.BYTES);
+        return array;
+    }
+
     private static WCPath getPath(WCGraphicsManager gm, ByteBuffer buf) {
         WCPath path = (WCPath) gm.getRef(buf.getInt());
         path.setWindingRule(buf.getInt());
         return path;
     }
 
+    private static WCPath getPathSegments(WCGraphicsManager gm, ByteBuffer buf) {
+        WCPath path = gm.createWCPath();
+        path.setWindingRule(buf.getInt());
+        path.addSegments(buf);
+        return path;
+    }
+
     private static WCPoint getPoint(ByteBuffer buf) {
         return new WCPoint(buf.getFloat(),
                            buf.getFloat());
@@ -485,6 +542,14 @@ public final class GraphicsDecoder  {
                          buf.getFloat());
     }
 
+    static Color getPackedColor(ByteBuffer buf) {
+        int argb = buf.getInt();
+        return new Color(((argb >> 16) & 0xFF) / 255f,
+                         ((argb >> 8) & 0xFF) / 255f,
+                         (argb & 0xFF) / 255f,
+                         ((argb >> 24) & 0xFF) / 255f);
+    }
+
     private static WCGradient getGradient(WCGraphicsContext gc, ByteBuffer buf) {
         WCPoint p1 = getPoint(buf);
         WCPoint p2 = getPoint(buf);
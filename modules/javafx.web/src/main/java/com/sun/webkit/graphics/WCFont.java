@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2018, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -25,6 +25,8 @@
 
 package com.sun.webkit.graphics;
 
+import java.nio.ByteBuffer;
+
 public abstract class WCFont extends Ref {
 
     public abstract Object getPlatformFont();
@@ -37,9 +39,27 @@ public abstract class WCFont extends Ref {
 
     public abstract float getXHeight();
 
-    public abstract double getGlyphWidth(int glyph);
+    /**
+     * Writes the advances (floats) of consecutive glyphs, starting with
+     * {@code firstGlyph}, into the given buffer in native byte order, until
+     * the buffer is full.
+     */
+    public abstract void getGlyphWidths(int firstGlyph, ByteBuffer buffer);
 
-    public abstract float[] getGlyphBoundingBox(int glyph);
+    /**
+     * Writes the bounding boxes of consecutive glyphs, starting with
+     * {@code firstGlyph}, into the given buffer as x, y, width and height
+     * (floats) in native byte order, until the buffer is full.
+     */
+    public abstract void getGlyphBoundingBoxes(int firstGlyph, ByteBuffer buffer);
+
+    /**
+     * Returns the path of the font file whose glyph metrics this font
+     * reports, or {@code null} if they cannot be read from a plain font
+     * file (embedded fonts and font collections).
+     * NB: This method is called from native code!
+     */
+    public abstract String getFontFile();
 
     /**
      * Returns a hash code value for the object.
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2018, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -52,7 +52,26 @@ public abstract class WCImage extends Ref {
 
     public ByteBuffer getPixelBuffer() {return null;}
 
-    protected void drawPixelBuffer() {}
+    /**
+     * Makes the image keep its pixels in the given direct buffer, which is
+     * owned by native code.
+     * NB: This method is called from native code!
+     */
+    protected void setPixelBuffer(ByteBuffer buffer) {}
+
+    /**
+     * Takes over the buffer given to {@link #setPixelBuffer}, which native
+     * code no longer uses, and frees it once nothing reads from it any more.
+     * The image keeps its pixels in a buffer of its own afterwards.
+     * NB: This method is called from native code!
+     */
+    protected void releasePixelBuffer(ByteBuffer buffer) {
+        twkFreePixelBuffer(buffer);
+    }
+
+    protected static native void twkFreePixelBuffer(ByteBuffer buffer);
+
+    protected void drawPixelBuffer(int x, int y, int w, int h) {}
 
     public synchronized void setRQ(WCRenderQueue rq) {
         this.rq = rq;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2017, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -25,16 +25,20 @@
 
 package com.sun.webkit.graphics;
 
+import java.nio.ByteBuffer;
 
 public abstract class WCImageDecoder {
 
     /**
      * Receives a portion of image data.
      *
+     * The buffer may be a view of native memory, which stays valid
+     * until {@link #destroy} returns.
+     *
      * @param data  a portion of image data,
      *              or {@code null} if all data received
      */
-    protected abstract void addImageData(byte[] data);
+    protected abstract void addImageData(ByteBuffer data);
 
     /**
      * Returns image size.
@@ -54,6 +58,16 @@ public abstract class WCImageDecoder {
      */
     protected abstract WCImageFrame getFrame(int index);
 
+    /**
+     * Returns image frame at the specified index decoded to the given
+     * size, which is smaller than the image size. Implementations that
+     * cannot scale the frame while decoding return the full size frame.
+     * @param index frame index
+     * @param width requested frame width
+     * @param height requested frame height
+     */
+    protected abstract WCImageFrame getScaledFrame(int index, int width, int height);
+
     /**
      * Returns frame duration in ms
      * @param index frame index
@@ -67,6 +81,15 @@ public abstract class WCImageDecoder {
      */
     protected abstract int[] getFrameSize(int index);
 
+    /**
+     * Returns the size of the frame {@link #getScaledFrame} returns for the
+     * same arguments, which is the full frame size where it cannot scale.
+     * @param index frame index
+     * @param width requested frame width
+     * @param height requested frame height
+     */
+    protected abstract int[] getScaledFrameSize(int index, int width, int height);
+
     /**
      * Returns whether the frame is complete or partial
      * @param index frame index
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2021, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -26,6 +26,8 @@
 package com.sun.webkit.graphics;
 
 import java.lang.annotation.Native;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
 
 public abstract class WCPath<P> extends Ref {
 
@@ -53,6 +55,21 @@ public abstract class WCPath<P> extends Ref {
      */
     @Native public static final int RULE_EVENODD = 1;
 
+    /* Segment kinds of the packed path format written by PathJava.cpp,
+     * see addSegments(ByteBuffer).
+     */
+    @Native public static final int SEGMENT_MOVETO = 0;
+    @Native public static final int SEGMENT_LINETO = 1;
+    @Native public static final int SEGMENT_QUADTO = 2;
+    @Native public static final int SEGMENT_CUBICTO = 3;
+    @Native public static final int SEGMENT_CLOSE = 4;
+    @Native public static final int SEGMENT_ARCTO = 5;
+    @Native public static final int SEGMENT_ARC = 6;
+    @Native public static final int SEGMENT_ELLIPSE = 7;
+    @Native public static final int SEGMENT_RECT = 8;
+    @Native public static final int SEGMENT_TRANSFORM = 9;
+    @Native public static final int SEGMENT_PATH = 10;
+
     public abstract void addRect(double x, double y, double w, double h);
 
     public abstract void addEllipse(double x, double y, double w, double h);
@@ -98,6 +115,76 @@ public abstract class WCPath<P> extends Ref {
 
     public abstract WCPathIterator getPathIterator();
 
+    /**
+     * Appends the segments stored in the packed format written by
+     * PathJava.cpp: the number of segments followed by the kind and
+     * the arguments of each segment, in native byte order.
+     */
+    public void addSegments(ByteBuffer buf) {
+        buf.order(ByteOrder.nativeOrder());
+        int count = buf.getInt();
+        for (int i = 0; i < count; i++) {
+            int kind = buf.getInt();
+            switch (kind) {
+                case SEGMENT_MOVETO:
+                    moveTo(buf.getFloat(), buf.getFloat());
+                    break;
+                case SEGMENT_LINETO:
+                    addLineTo(buf.getFloat(), buf.getFloat());
+                    break;
+                case SEGMENT_QUADTO:
+                    addQuadCurveTo(buf.getFloat(), buf.getFloat(),
+                                   buf.getFloat(), buf.getFloat());
+                    break;
+                case SEGMENT_CUBICTO:
+                    addBezierCurveTo(buf.getFloat(), buf.getFloat(),
+                                     buf.getFloat(), buf.getFloat(),
+                                     buf.getFloat(), buf.getFloat());
+                    break;
+                case SEGMENT_CLOSE:
+                    closeSubpath();
+                    break;
+                case SEGMENT_ARCTO:
+                    addArcTo(buf.getFloat(), buf.getFloat(),
+                             buf.getFloat(), buf.getFloat(),
+                             buf.getFloat());
+                    break;
+                case SEGMENT_ARC:
+                    addArc(buf.getFloat(), buf.getFloat(), buf.getFloat(),
+                           buf.getFloat(), buf.getFloat(), buf.getInt() != 0);
+                    break;
+                case SEGMENT_ELLIPSE:
+                    addEllipse(buf.getFloat(), buf.getFloat(),
+                               buf.getFloat(), buf.getFloat());
+                    break;
+                case SEGMENT_RECT:
+                    addRect(buf.getFloat(), buf.getFloat(),
+                            buf.getFloat(), buf.getFloat());
+                    break;
+                case SEGMENT_TRANSFORM:
+                    transform(buf.getFloat(), buf.getFloat(),
+                              buf.getFloat(), buf.getFloat(),
+                              buf.getFloat(), buf.getFloat());
+                    break;
+                case SEGMENT_PATH: {
+                    // A transform followed by the packed segments of the
+                    // appended path.
+                    float a = buf.getFloat(), b = buf.getFloat();
+                    float c = buf.getFloat(), d = buf.getFloat();
+                    float e = buf.getFloat(), f = buf.getFloat();
+                    WCPath path = WCGraphicsManager.getGraphicsManager().createWCPath();
+                    path.addSegments(buf);
+                    path.transform(a, b, c, d, e, f);
+                    addPath(path);
+                    break;
+                }
+                default:
+                    throw new IllegalArgumentException(
+                            "Unknown path segment kind: " + kind);
+            }
+        }
+    }
+
     public abstract boolean strokeContains(double x, double y,
                                            double thickness, double miterLimit,
                                            int cap, int join, double dashOffset,
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2021, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -168,16 +168,6 @@ public abstract class WCRenderQueue extends Ref {
         return currentBuffer.addString(str);
     }
 
-    /*is called from native*/
-    private int refIntArr(int[] arr) {
-        return currentBuffer.addIntArray(arr);
-    }
-
-    /*is called from native*/
-    private int refFloatArr(float[] arr) {
-        return currentBuffer.addFloatArray(arr);
-    }
-
     public boolean isOpaque() {
         return opaque;
     }
@@ -196,10 +186,6 @@ final class BufferData {
     private final AtomicInteger idCount = new AtomicInteger(0);
     private final HashMap<Integer,String> strMap =
             new HashMap<Integer,String>();
-    private final HashMap<Integer,int[]> intArrMap =
-            new HashMap<Integer,int[]>();
-    private final HashMap<Integer,float[]> floatArrMap =
-            new HashMap<Integer,float[]>();
 
     private ByteBuffer buffer;
 
@@ -207,26 +193,6 @@ final class BufferData {
         return idCount.incrementAndGet();
     }
 
-    int addIntArray(int[] a) {
-        int id = createID();
-        intArrMap.put(id, a);
-        return id;
-    }
-
-    int[] getIntArray(int id) {
-        return intArrMap.get(id);
-    }
-
-    int addFloatArray(float[] a) {
-        int id = createID();
-        floatArrMap.put(id, a);
-        return id;
-    }
-
-    float[] getFloatArray(int id) {
-        return floatArrMap.get(id);
-    }
-
     int addString(String s) {
         int id = createID();
         strMap.put(id, s);
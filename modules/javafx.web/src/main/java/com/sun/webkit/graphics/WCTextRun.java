@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2018, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -25,12 +25,18 @@
 
 package com.sun.webkit.graphics;
 
+import java.nio.ByteBuffer;
+
 public interface WCTextRun {
+    /**
+     * Writes, for every glyph of the run, the glyph code and char offset
+     * (ints) followed by the x and y position and the advance (floats)
+     * into the given buffer, in native byte order.
+     */
+    void getGlyphData(ByteBuffer buffer);
+
     boolean isLeftToRight();
-    float[] getGlyphPosAndAdvance(int glyphIndex);
-    int getCharOffset(int index);
     int getEnd();
-    int getGlyph(int index);
     int getGlyphCount();
     int getStart();
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2019, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -29,6 +29,7 @@ import java.nio.ByteBuffer;
 import java.util.Queue;
 import java.util.concurrent.ConcurrentLinkedQueue;
 import java.util.concurrent.Semaphore;
+import java.util.concurrent.atomic.AtomicInteger;
 
 /**
  * A pool of byte buffers that can be shared by multiple concurrent
@@ -42,25 +43,55 @@ final class ByteBufferPool {
     private final Queue<ByteBuffer> byteBuffers =
             new ConcurrentLinkedQueue<ByteBuffer>();
 
+    /**
+     * The number of byte buffers in {@link #byteBuffers}.
+     */
+    private final AtomicInteger pooledCount = new AtomicInteger();
+
+    /**
+     * The number of byte buffers currently handed off to native code.
+     */
+    private final AtomicInteger handedOffCount = new AtomicInteger();
+
     /**
      * The size of each byte buffer.
      */
     private final int bufferSize;
 
+    /**
+     * The maximum number of byte buffers kept for reuse.
+     */
+    private final int maxPooledCount;
+
+    /**
+     * The maximum number of byte buffers handed off to native code
+     * at any given time moment.
+     */
+    private final int maxHandedOffCount;
+
 
     /**
      * Creates a new pool.
      */
-    private ByteBufferPool(int bufferSize) {
+    private ByteBufferPool(int bufferSize, int maxPooledCount,
+                           int maxHandedOffCount)
+    {
         this.bufferSize = bufferSize;
+        this.maxPooledCount = maxPooledCount;
+        this.maxHandedOffCount = maxHandedOffCount;
     }
 
 
     /**
-     * Creates a new pool.
+     * Creates a new pool that keeps at most {@code maxPooledCount}
+     * released buffers for reuse and lets at most {@code maxHandedOffCount}
+     * buffers be handed off to native code at a time.
      */
-    static ByteBufferPool newInstance(int bufferSize) {
-        return new ByteBufferPool(bufferSize);
+    static ByteBufferPool newInstance(int bufferSize, int maxPooledCount,
+                                      int maxHandedOffCount)
+    {
+        return new ByteBufferPool(bufferSize, maxPooledCount,
+                maxHandedOffCount);
     }
 
     /**
@@ -74,6 +105,35 @@ final class ByteBufferPool {
         return new ByteBufferAllocatorImpl(maxBufferCount);
     }
 
+    /**
+     * Returns the number of byte buffers currently handed off to native code.
+     */
+    int getHandedOffCount() {
+        return handedOffCount.get();
+    }
+
+    /**
+     * Returns a byte buffer handed off to native code back to this pool.
+     * Called by native code once WebCore no longer references the buffer.
+     */
+    private void fwkRecycle(ByteBuffer byteBuffer) {
+        handedOffCount.decrementAndGet();
+        recycle(byteBuffer);
+    }
+
+    /**
+     * Keeps a released byte buffer for reuse, unless the pool is full
+     * already, in which case the buffer is left to the garbage collector.
+     */
+    private void recycle(ByteBuffer byteBuffer) {
+        if (pooledCount.incrementAndGet() > maxPooledCount) {
+            pooledCount.decrementAndGet();
+            return;
+        }
+        byteBuffer.clear();
+        byteBuffers.add(byteBuffer);
+    }
+
     /**
      * The allocator implementation.
      */
@@ -103,6 +163,8 @@ final class ByteBufferPool {
             ByteBuffer byteBuffer = byteBuffers.poll();
             if (byteBuffer == null) {
                 byteBuffer = ByteBuffer.allocateDirect(bufferSize);
+            } else {
+                pooledCount.decrementAndGet();
             }
             return byteBuffer;
         }
@@ -112,10 +174,22 @@ final class ByteBufferPool {
          */
         @Override
         public void release(ByteBuffer byteBuffer) {
-            byteBuffer.clear();
-            byteBuffers.add(byteBuffer);
+            recycle(byteBuffer);
             semaphore.release();
         }
+
+        /**
+         * {@inheritDoc}
+         */
+        @Override
+        public boolean tryHandOff(ByteBuffer byteBuffer) {
+            if (handedOffCount.incrementAndGet() > maxHandedOffCount) {
+                handedOffCount.decrementAndGet();
+                return false;
+            }
+            semaphore.release();
+            return true;
+        }
     }
 }
 
@@ -133,4 +207,13 @@ interface ByteBufferAllocator {
      * Releases a byte buffer.
      */
     void release(ByteBuffer byteBuffer);
+
+    /**
+     * Releases a byte buffer so that its ownership can be transferred to
+     * native code, if the pool allows for one more buffer held by native
+     * code. The buffer is not returned to the pool until native code is
+     * done with it. If {@code false} is returned, the buffer remains
+     * allocated and must be released as usual.
+     */
+    boolean tryHandOff(ByteBuffer byteBuffer);
 }
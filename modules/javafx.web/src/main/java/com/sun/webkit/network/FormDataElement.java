@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2014, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -25,12 +25,16 @@
 
 package com.sun.webkit.network;
 
+import com.sun.webkit.Disposer;
+import com.sun.webkit.DisposerRecord;
+import com.sun.webkit.Invoker;
 import java.io.BufferedInputStream;
-import java.io.ByteArrayInputStream;
 import java.io.File;
 import java.io.FileInputStream;
 import java.io.IOException;
 import java.io.InputStream;
+import java.nio.ByteBuffer;
+import java.util.Objects;
 
 /**
  * A form data element, such as a byte array or a local file.
@@ -86,6 +90,26 @@ abstract class FormDataElement {
         }
     }
 
+    /**
+     * Releases the native data backing this element, if any. Called by
+     * loaders once they are finished or canceled. The content of this
+     * element cannot be read any more afterwards. This method may be
+     * called on any thread, and more than once.
+     */
+    void release() {
+    }
+
+    /**
+     * Releases the native data backing the given elements.
+     */
+    static void releaseAll(FormDataElement[] formDataElements) {
+        if (formDataElements != null) {
+            for (FormDataElement formDataElement : formDataElements) {
+                formDataElement.release();
+            }
+        }
+    }
+
     /**
      * Creates the input stream from which the content of this element
      * can be read.
@@ -99,64 +123,250 @@ abstract class FormDataElement {
 
 
     /**
-     * Creates a new FormDataElement from a byte array.
+     * Creates a new FormDataElement from a direct byte buffer wrapping
+     * native form data, so that the element's content is read in place
+     * rather than copied up front. The native data is released by the
+     * loader through {@link #release}, or else once the buffer becomes
+     * unreachable.
+     */
+    private static FormDataElement fwkCreateFromDirectBuffer(
+            ByteBuffer byteBuffer, long nativePointer)
+    {
+        if (byteBuffer == null) {
+            return new ByteBufferElement(ByteBuffer.allocate(0), null);
+        }
+        FormDataDisposer disposer = new FormDataDisposer(nativePointer);
+        Disposer.addRecord(byteBuffer, disposer);
+        return new ByteBufferElement(byteBuffer.asReadOnlyBuffer(), disposer);
+    }
+
+    /**
+     * Creates a new FormDataElement from a range of a file. A negative
+     * {@code length} denotes the rest of the file.
      */
-    private static FormDataElement fwkCreateFromByteArray(byte[] byteArray) {
-        return new ByteArrayElement(byteArray);
+    private static FormDataElement fwkCreateFromFile(String fileName,
+                                                     long start,
+                                                     long length)
+    {
+        return new FileElement(fileName, start, length);
     }
 
+    private static native void twkReleaseFormData(long nativePointer);
+
     /**
-     * Creates a new FormDataElement from a file.
+     * Releases the native form data wrapped by a direct byte buffer.
+     * Runs on the event thread.
      */
-    private static FormDataElement fwkCreateFromFile(String fileName) {
-        return new FileElement(fileName);
+    private static final class FormDataDisposer implements DisposerRecord {
+        private long nativePointer;
+
+        private FormDataDisposer(long nativePointer) {
+            this.nativePointer = nativePointer;
+        }
+
+        @Override public void dispose() {
+            if (nativePointer != 0) {
+                twkReleaseFormData(nativePointer);
+                nativePointer = 0;
+            }
+        }
     }
 
     /**
-     * A form data element based on a byte array.
+     * A form data element based on a byte buffer.
      */
-    private static final class ByteArrayElement extends FormDataElement {
+    private static final class ByteBufferElement extends FormDataElement {
+
+        private final ByteBuffer byteBuffer;
+        private final FormDataDisposer disposer;
 
-        private final byte[] byteArray;
+        /**
+         * Whether the native data has been released. Guarded by this
+         * element, which streams hold while they read from the buffer.
+         */
+        private boolean released;
 
 
-        private ByteArrayElement(byte[] byteArray) {
-            this.byteArray = byteArray;
+        private ByteBufferElement(ByteBuffer byteBuffer,
+                                  FormDataDisposer disposer)
+        {
+            this.byteBuffer = byteBuffer;
+            this.disposer = disposer;
         }
 
 
+        @Override
+        void release() {
+            synchronized (this) {
+                if (released) {
+                    return;
+                }
+                released = true;
+            }
+            if (disposer != null) {
+                Invoker.getInvoker().invokeOnEventThread(disposer::dispose);
+            }
+        }
+
         @Override
         protected InputStream createInputStream() {
-            return new ByteArrayInputStream(byteArray);
+            return new ByteBufferInputStream(this, byteBuffer.duplicate());
         }
 
         @Override
         protected long doGetSize() {
-            return byteArray.length;
+            return byteBuffer.remaining();
+        }
+    }
+
+    /**
+     * An input stream that reads the remaining bytes of the byte buffer
+     * of an element, for as long as its native data has not been released.
+     */
+    private static final class ByteBufferInputStream extends InputStream {
+
+        private final ByteBufferElement element;
+        private final ByteBuffer byteBuffer;
+
+
+        private ByteBufferInputStream(ByteBufferElement element,
+                                      ByteBuffer byteBuffer)
+        {
+            this.element = element;
+            this.byteBuffer = byteBuffer;
+        }
+
+
+        private void checkNotReleased() throws IOException {
+            if (element.released) {
+                throw new IOException("Form data has been released");
+            }
+        }
+
+        @Override
+        public int read() throws IOException {
+            synchronized (element) {
+                checkNotReleased();
+                return byteBuffer.hasRemaining() ? byteBuffer.get() & 0xff : -1;
+            }
+        }
+
+        @Override
+        public int read(byte[] b, int off, int len) throws IOException {
+            Objects.checkFromIndexSize(off, len, b.length);
+            if (len == 0) {
+                return 0;
+            }
+            synchronized (element) {
+                checkNotReleased();
+                if (!byteBuffer.hasRemaining()) {
+                    return -1;
+                }
+                int count = Math.min(len, byteBuffer.remaining());
+                byteBuffer.get(b, off, count);
+                return count;
+            }
+        }
+
+        @Override
+        public long skip(long n) {
+            int count = (int) Math.max(0, Math.min(n, byteBuffer.remaining()));
+            byteBuffer.position(byteBuffer.position() + count);
+            return count;
+        }
+
+        @Override
+        public int available() {
+            return byteBuffer.remaining();
         }
     }
 
     /**
-     * A form data element based on a file.
+     * A form data element based on a range of a file.
      */
     private static final class FileElement extends FormDataElement {
 
         private final File file;
+        private final long start;
+        private final long length;
 
 
-        private FileElement(String filename) {
+        private FileElement(String filename, long start, long length) {
             file = new File(filename);
+            this.start = start;
+            this.length = length;
         }
 
 
         @Override
         protected InputStream createInputStream() throws IOException {
-            return new BufferedInputStream(new FileInputStream(file));
+            FileInputStream in = new FileInputStream(file);
+            if (start == 0 && length < 0) {
+                return new BufferedInputStream(in);
+            }
+            try {
+                in.getChannel().position(start);
+            } catch (IOException ex) {
+                in.close();
+                throw ex;
+            }
+            return new BufferedInputStream(new BoundedInputStream(in, doGetSize()));
         }
 
         @Override
         protected long doGetSize() {
-            return file.length();
+            long available = Math.max(0, file.length() - start);
+            return length < 0 ? available : Math.min(length, available);
+        }
+    }
+
+    /**
+     * An input stream that reads at most a given number of bytes from
+     * another stream.
+     */
+    private static final class BoundedInputStream extends InputStream {
+
+        private final InputStream in;
+        private long remaining;
+
+
+        private BoundedInputStream(InputStream in, long remaining) {
+            this.in = in;
+            this.remaining = remaining;
+        }
+
+
+        @Override
+        public int read() throws IOException {
+            if (remaining <= 0) {
+                return -1;
+            }
+            int b = in.read();
+            if (b != -1) {
+                remaining--;
+            }
+            return b;
+        }
+
+        @Override
+        public int read(byte[] b, int off, int len) throws IOException {
+            Objects.checkFromIndexSize(off, len, b.length);
+            if (len == 0) {
+                return 0;
+            }
+            if (remaining <= 0) {
+                return -1;
+            }
+            int count = in.read(b, off, (int) Math.min(len, remaining));
+            if (count > 0) {
+                remaining -= count;
+            }
+            return count;
+        }
+
+        @Override
+        public void close() throws IOException {
+            in.close();
         }
     }
 }
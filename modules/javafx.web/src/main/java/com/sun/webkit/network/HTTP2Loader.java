@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, 2021, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2019, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -92,6 +92,8 @@ final class HTTP2Loader extends URLLoaderBase {
             PlatformLogger.getLogger(URLLoader.class.getName());
 
     private final WebPage webPage;
+    private final ByteBufferPool byteBufferPool;
+    private final ByteBufferAllocator allocator;
     private final boolean asynchronous;
     private String url;
     private String method;
@@ -110,17 +112,13 @@ final class HTTP2Loader extends URLLoaderBase {
                 .connectTimeout(Duration.ofSeconds(30)) // FIXME: Add a property to control the timeout
                 .cookieHandler(CookieHandler.getDefault())
                 .build());
-    // Singleton instance of direct ByteBuffer to transfer downloaded bytes from
-    // Java to native
-    private static final int DEFAULT_BUFSIZE = 40 * 1024;
-    private final static ByteBuffer BUFFER;
-    static {
-       @SuppressWarnings("removal")
-       int bufSize  = AccessController.doPrivileged(
-                        (PrivilegedAction<Integer>) () ->
-                            Integer.valueOf(System.getProperty("jdk.httpclient.bufsize", Integer.toString(DEFAULT_BUFSIZE))));
-       BUFFER = ByteBuffer.allocateDirect(bufSize);
-    }
+    // Number of pooled buffers a loader holds at a time. Each one is handed
+    // off or released before the next is allocated on the event thread.
+    private static final int MAX_BUF_COUNT = 1;
+    // Number of body chunks requested ahead of their delivery to WebCore.
+    // Chunks are only requested again as WebCore consumes them, so reading
+    // stops while the load is deferred.
+    private static final int MAX_PENDING_CHUNKS = 3;
 
     /**
      * Creates a new {@code HTTP2Loader}.
@@ -339,8 +337,7 @@ final class HTTP2Loader extends URLLoaderBase {
 
             @Override
             public void onNext(final List<ByteBuffer> bytes) {
-                didReceiveData(bytes);
-                requestIfNotCancelled();
+                didReceiveData(bytes, () -> requestIfNotCancelled(1));
             }
 
             @Override
@@ -349,15 +346,15 @@ final class HTTP2Loader extends URLLoaderBase {
                     subscription.cancel();
                 } else {
                     this.subscription = subscription;
-                    requestIfNotCancelled();
+                    requestIfNotCancelled(MAX_PENDING_CHUNKS);
                 }
             }
 
-            private void requestIfNotCancelled() {
+            private void requestIfNotCancelled(long n) {
                 if (canceled) {
                     subscription.cancel();
                 } else {
-                    subscription.request(1);
+                    subscription.request(n);
                 }
             }
         });
@@ -379,6 +376,8 @@ final class HTTP2Loader extends URLLoaderBase {
               long data)
     {
         this.webPage = webPage;
+        this.byteBufferPool = byteBufferPool;
+        this.allocator = byteBufferPool.newAllocator(MAX_BUF_COUNT);
         this.asynchronous = asynchronous;
         this.url = url;
         this.method = method;
@@ -391,6 +390,7 @@ final class HTTP2Loader extends URLLoaderBase {
             uri = toURI();
         } catch(MalformedURLException e) {
             this.response = null;
+            FormDataElement.releaseAll(formDataElements);
             didFail(e);
             return;
         }
@@ -415,7 +415,9 @@ final class HTTP2Loader extends URLLoaderBase {
         var tmpResponse = AccessController.doPrivileged((PrivilegedAction<CompletableFuture<Void>>) () -> {
             return HTTP_CLIENT.sendAsync(request, bodyHandler)
                               .thenAccept($ -> {})
-                              .exceptionally(ex -> didFail(ex.getCause()));
+                              .exceptionally(ex -> didFail(ex.getCause()))
+                              // The request body is not read any more
+                              .whenComplete(($, th) -> FormDataElement.releaseAll(formDataElements));
         }, webPage.getAccessControlContext());
         this.response = tmpResponse;
 
@@ -433,10 +435,12 @@ final class HTTP2Loader extends URLLoaderBase {
             logger.finest(String.format("data: [0x%016X]", data));
         }
         canceled = true;
+        FormDataElement.releaseAll(formDataElements);
+        releaseDeferredCallbacks();
     }
 
     private void callBackIfNotCanceled(final Runnable r) {
-        Invoker.getInvoker().invokeOnEventThread(() -> {
+        invokeOnEventThread(() -> {
             if (!canceled) {
                 r.run();
             }
@@ -522,36 +526,49 @@ final class HTTP2Loader extends URLLoaderBase {
         });
     }
 
-    private ByteBuffer getDirectBuffer(int size) {
-        ByteBuffer dbb = BUFFER;
-        // Though the chance of reaching here is rare, handle the
-        // case by allocating a tmp direct buffer.
-        if (size > dbb.capacity()) {
-            dbb = ByteBuffer.allocateDirect(size);
-        }
-        return dbb.clear();
-    }
-
-    private ByteBuffer copyToDirectBuffer(final ByteBuffer bb) {
-        return getDirectBuffer(bb.limit()).put(bb).flip();
-    }
-
     // another variant to use from createZIPEncodedBodySubscriber
     private void didReceiveData(final byte[] bytes, int size) {
         callBackIfNotCanceled(() -> {
-            notifyDidReceiveData(getDirectBuffer(size).put(bytes, 0, size).flip());
+            copyToPooledBuffers(ByteBuffer.wrap(bytes, 0, size));
         });
     }
 
-    private void didReceiveData(final List<ByteBuffer> bytes) {
-        callBackIfNotCanceled(() -> bytes.stream()
-                                          .map(this::copyToDirectBuffer)
-                                          .forEach(this::notifyDidReceiveData)
-        );
+    private void didReceiveData(final List<ByteBuffer> bytes, final Runnable onDelivered) {
+        invokeOnEventThread(() -> {
+            if (!canceled) {
+                bytes.forEach(this::copyToPooledBuffers);
+            }
+            onDelivered.run();
+        });
     }
 
-    private void notifyDidReceiveData(ByteBuffer byteBuffer) {
+    private void copyToPooledBuffers(final ByteBuffer bb) {
         Invoker.getInvoker().checkEventThread();
+        while (bb.hasRemaining() && !canceled) {
+            final ByteBuffer byteBuffer;
+            try {
+                byteBuffer = allocator.allocate();
+            } catch (InterruptedException ex) {
+                didFail(ex);
+                return;
+            }
+            final int limit = bb.limit();
+            bb.limit(bb.position() + Math.min(bb.remaining(), byteBuffer.remaining()));
+            byteBuffer.put(bb).flip();
+            bb.limit(limit);
+            // HTTP/2 chunks are mostly smaller than the pooled buffers, so
+            // unlike URLLoader partly filled ones are handed off as well. The
+            // pool bounds how many of them native code holds at a time.
+            if (allocator.tryHandOff(byteBuffer)) {
+                notifyDidReceiveData(byteBuffer, byteBufferPool);
+            } else {
+                notifyDidReceiveData(byteBuffer, null);
+                allocator.release(byteBuffer);
+            }
+        }
+    }
+
+    private void notifyDidReceiveData(ByteBuffer byteBuffer, ByteBufferPool pool) {
         if (logger.isLoggable(Level.FINEST)) {
             logger.finest(String.format(
                     "byteBuffer: [%s], "
@@ -563,7 +580,7 @@ final class HTTP2Loader extends URLLoaderBase {
                     byteBuffer.remaining(),
                     data));
         }
-        twkDidReceiveData(byteBuffer, byteBuffer.position(), byteBuffer.remaining(), data);
+        twkDidReceiveData(byteBuffer, byteBuffer.position(), byteBuffer.remaining(), pool, data);
     }
 
     private void didFinishLoading() {
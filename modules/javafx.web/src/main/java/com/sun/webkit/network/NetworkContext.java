@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2021, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -31,11 +31,12 @@ import java.net.MalformedURLException;
 import java.security.AccessController;
 import java.security.PrivilegedAction;
 import java.util.Arrays;
-import java.util.concurrent.LinkedBlockingQueue;
+import java.util.concurrent.PriorityBlockingQueue;
 import java.util.concurrent.ThreadFactory;
 import java.util.concurrent.ThreadPoolExecutor;
 import java.util.concurrent.TimeUnit;
 import java.util.concurrent.atomic.AtomicInteger;
+import java.util.concurrent.atomic.AtomicLong;
 
 import com.sun.javafx.logging.PlatformLogger;
 import com.sun.javafx.logging.PlatformLogger.Level;
@@ -64,9 +65,11 @@ final class NetworkContext {
 
     /**
      * The default value of the maximum concurrent connections for
-     * new gen HTTP2 client
+     * new gen HTTP2 client. Servers that only speak HTTP/1.1 get a
+     * connection per request, so this stays within the limit browsers
+     * use per host.
      */
-    private static final int DEFAULT_HTTP2_MAX_CONNECTIONS = 20;
+    private static final int DEFAULT_HTTP2_MAX_CONNECTIONS = 6;
 
     /**
      * The buffer size for the shared pool of byte buffers.
@@ -74,7 +77,20 @@ final class NetworkContext {
     private static final int BYTE_BUFFER_SIZE = 1024 * 40;
 
     /**
-     * The thread pool used to execute asynchronous loaders.
+     * The maximum number of released byte buffers kept in the shared pool
+     * for reuse.
+     */
+    private static final int MAX_POOLED_BYTE_BUFFER_COUNT = 64;
+
+    /**
+     * The maximum number of byte buffers of the shared pool that WebCore
+     * may hold at a time instead of copies of their contents (10 MB).
+     */
+    private static final int MAX_HANDED_OFF_BYTE_BUFFER_COUNT = 256;
+
+    /**
+     * The thread pool used to execute asynchronous loaders. Loaders waiting
+     * for a thread are started in order of their resource load priority.
      */
     private static final ThreadPoolExecutor threadPool;
 
@@ -88,7 +104,7 @@ final class NetworkContext {
                 THREAD_POOL_SIZE,
                 THREAD_POOL_KEEP_ALIVE_TIME,
                 TimeUnit.MILLISECONDS,
-                new LinkedBlockingQueue<Runnable>(),
+                new PriorityBlockingQueue<Runnable>(),
                 new URLLoaderThreadFactory());
         threadPool.allowCoreThreadTimeOut(true);
 
@@ -106,7 +122,9 @@ final class NetworkContext {
      * The shared pool of byte buffers.
      */
     private static final ByteBufferPool byteBufferPool =
-            ByteBufferPool.newInstance(BYTE_BUFFER_SIZE);
+            ByteBufferPool.newInstance(BYTE_BUFFER_SIZE,
+                    MAX_POOLED_BYTE_BUFFER_COUNT,
+                    MAX_HANDED_OFF_BYTE_BUFFER_COUNT);
 
 
     /**
@@ -139,6 +157,7 @@ final class NetworkContext {
      */
     private static URLLoaderBase fwkLoad(WebPage webPage,
                                      boolean asynchronous,
+                                     int priority,
                                      String url,
                                      String method,
                                      String headers,
@@ -149,6 +168,7 @@ final class NetworkContext {
             logger.finest(String.format(
                     "webPage: [%s], " +
                     "asynchronous: [%s], " +
+                    "priority: [%d], " +
                     "url: [%s], " +
                     "method: [%s], " +
                     "formDataElements: %s, " +
@@ -156,6 +176,7 @@ final class NetworkContext {
                     "headers:%n%s",
                     webPage,
                     asynchronous,
+                    priority,
                     url,
                     method,
                     formDataElements != null
@@ -189,7 +210,7 @@ final class NetworkContext {
                 formDataElements,
                 data);
         if (asynchronous) {
-            threadPool.submit(loader);
+            threadPool.execute(new PrioritizedLoader(loader, priority));
             if (logger.isLoggable(Level.FINEST)) {
                 logger.finest(
                         "active count: [{0}], " +
@@ -228,6 +249,48 @@ final class NetworkContext {
         return propValue >= 0 ? propValue : DEFAULT_HTTP_MAX_CONNECTIONS;
     }
 
+    // Package scope method for testing
+    static boolean test_usesHTTP2Loader() {
+        return useHTTP2Loader;
+    }
+
+    // Package scope method for testing
+    static int test_getHandedOffByteBufferCount() {
+        return byteBufferPool.getHandedOffCount();
+    }
+
+    /**
+     * A loader queued for execution, ordered by descending WebCore resource
+     * load priority and then by submission order.
+     */
+    private static final class PrioritizedLoader
+        implements Runnable, Comparable<PrioritizedLoader>
+    {
+        private static final AtomicLong sequence = new AtomicLong();
+
+        private final URLLoader loader;
+        private final int priority;
+        private final long sequenceNumber = sequence.getAndIncrement();
+
+        private PrioritizedLoader(URLLoader loader, int priority) {
+            this.loader = loader;
+            this.priority = priority;
+        }
+
+        @Override
+        public void run() {
+            loader.run();
+        }
+
+        @Override
+        public int compareTo(PrioritizedLoader other) {
+            if (priority != other.priority) {
+                return Integer.compare(other.priority, priority);
+            }
+            return Long.compare(sequenceNumber, other.sequenceNumber);
+        }
+    }
+
     /**
      * Thread factory for URL loader threads.
      */
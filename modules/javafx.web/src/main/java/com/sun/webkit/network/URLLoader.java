@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2021, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -27,7 +27,6 @@ package com.sun.webkit.network;
 
 import com.sun.javafx.logging.PlatformLogger;
 import com.sun.javafx.logging.PlatformLogger.Level;
-import com.sun.webkit.Invoker;
 import com.sun.webkit.LoadListenerClient;
 import com.sun.webkit.WebPage;
 import static com.sun.webkit.network.URLs.newURL;
@@ -117,6 +116,8 @@ final class URLLoader extends URLLoaderBase implements Runnable {
             logger.finest(String.format("data: [0x%016X]", data));
         }
         canceled = true;
+        FormDataElement.releaseAll(formDataElements);
+        releaseDeferredCallbacks();
     }
 
     /**
@@ -218,6 +219,9 @@ final class URLLoader extends URLLoaderBase implements Runnable {
             errorCode = LoadListenerClient.UNKNOWN_ERROR;
         }
 
+        // The request body is not read any more
+        FormDataElement.releaseAll(formDataElements);
+
         if (error != null) {
             if (errorCode == LoadListenerClient.UNKNOWN_ERROR) {
                 logger.warning("Unexpected error", error);
@@ -733,19 +737,28 @@ final class URLLoader extends URLLoaderBase implements Runnable {
                                 final ByteBufferAllocator allocator)
     {
         callBack(() -> {
-            if (!canceled) {
-                notifyDidReceiveData(
-                        byteBuffer,
-                        byteBuffer.position(),
-                        byteBuffer.remaining());
+            if (canceled) {
+                allocator.release(byteBuffer);
+            } else if (byteBuffer.remaining() == byteBuffer.capacity()
+                    && allocator.tryHandOff(byteBuffer))
+            {
+                // Full buffers are kept by native code without copying
+                notifyDidReceiveData(byteBuffer, byteBuffer.position(),
+                        byteBuffer.remaining(), byteBufferPool);
+            } else {
+                // Short ones, typically the tail of a response, are copied
+                // so that they do not pin a whole buffer
+                notifyDidReceiveData(byteBuffer, byteBuffer.position(),
+                        byteBuffer.remaining(), null);
+                allocator.release(byteBuffer);
             }
-            allocator.release(byteBuffer);
         });
     }
 
     private void notifyDidReceiveData(ByteBuffer byteBuffer,
                                       int position,
-                                      int remaining)
+                                      int remaining,
+                                      ByteBufferPool pool)
     {
         if (logger.isLoggable(Level.FINEST)) {
             logger.finest(String.format(
@@ -758,7 +771,7 @@ final class URLLoader extends URLLoaderBase implements Runnable {
                     remaining,
                     data));
         }
-        twkDidReceiveData(byteBuffer, position, remaining, data);
+        twkDidReceiveData(byteBuffer, position, remaining, pool, data);
     }
 
     private void didFinishLoading() {
@@ -802,7 +815,7 @@ final class URLLoader extends URLLoaderBase implements Runnable {
 
     private void callBack(Runnable runnable) {
         if (asynchronous) {
-            Invoker.getInvoker().invokeOnEventThread(runnable);
+            invokeOnEventThread(runnable);
         } else {
             runnable.run();
         }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018, 2019, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2018, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -25,17 +25,69 @@
 
 package com.sun.webkit.network;
 
+import com.sun.webkit.Invoker;
 import java.lang.annotation.Native;
 import java.nio.ByteBuffer;
+import java.util.ArrayDeque;
 
 abstract class URLLoaderBase {
     @Native public static final int ALLOW_UNASSIGNED = java.net.IDN.ALLOW_UNASSIGNED;
 
+    /**
+     * Whether WebCore has deferred this load. Accessed on the event
+     * thread only.
+     */
+    private boolean defersLoading;
+
+    /**
+     * Callbacks held back while the load is deferred. Accessed on the
+     * event thread only.
+     */
+    private final ArrayDeque<Runnable> deferredCallbacks = new ArrayDeque<>();
+
     /**
      * Cancels the loader.
      */
     protected abstract void fwkCancel();
 
+    /**
+     * Suspends or resumes the delivery of callbacks to WebCore. Called
+     * on the event thread.
+     */
+    private void fwkSetDefersLoading(boolean defers) {
+        defersLoading = defers;
+        while (!defersLoading && !deferredCallbacks.isEmpty()) {
+            deferredCallbacks.poll().run();
+        }
+    }
+
+    /**
+     * Stops deferring callbacks once the load has been canceled, and runs
+     * the ones held back. They no longer notify WebCore then, but they
+     * still release what they hold, such as pooled buffers or outstanding
+     * demand from the network, so that the loader can wind down. WebCore
+     * never resumes a canceled load itself. Called on the event thread.
+     */
+    protected final void releaseDeferredCallbacks() {
+        fwkSetDefersLoading(false);
+    }
+
+    /**
+     * Runs a callback on the event thread, unless the load is deferred,
+     * in which case the callback runs once the load is resumed.
+     * Loaders that bound the amount of data in flight stop reading from
+     * the network while their callbacks are held back.
+     */
+    protected final void invokeOnEventThread(Runnable runnable) {
+        Invoker.getInvoker().invokeOnEventThread(() -> {
+            if (defersLoading) {
+                deferredCallbacks.add(runnable);
+            } else {
+                runnable.run();
+            }
+        });
+    }
+
     protected static native void twkDidSendData(long totalBytesSent,
                                               long totalBytesToBeSent,
                                               long data);
@@ -56,9 +108,16 @@ abstract class URLLoaderBase {
                                                      String url,
                                                      long data);
 
+    /**
+     * Passes received bytes to native code. If {@code pool} is not
+     * {@code null}, native code keeps {@code byteBuffer} instead of
+     * copying its contents, and hands the buffer back to {@code pool}
+     * once it is no longer used.
+     */
     protected static native void twkDidReceiveData(ByteBuffer byteBuffer,
                                                  int position,
                                                  int remaining,
+                                                 ByteBufferPool pool,
                                                  long data);
 
     protected static native void twkDidFinishLoading(long data);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2018, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -28,6 +28,7 @@ package com.sun.webkit.perf;
 import com.sun.javafx.logging.PlatformLogger;
 import com.sun.webkit.graphics.WCFont;
 import com.sun.webkit.graphics.WCTextRun;
+import java.nio.ByteBuffer;
 
 public final class WCFontPerfLogger extends WCFont {
     private static final PlatformLogger log =
@@ -85,17 +86,22 @@ public final class WCFontPerfLogger extends WCFont {
         return res;
     }
 
-    public double getGlyphWidth(int glyph) {
-        logger.resumeCount("GETGLYPHWIDTH");
-        double res = fnt.getGlyphWidth(glyph);
-        logger.suspendCount("GETGLYPHWIDTH");
-        return res;
+    public void getGlyphWidths(int firstGlyph, ByteBuffer buffer) {
+        logger.resumeCount("GETGLYPHWIDTHS");
+        fnt.getGlyphWidths(firstGlyph, buffer);
+        logger.suspendCount("GETGLYPHWIDTHS");
+    }
+
+    public void getGlyphBoundingBoxes(int firstGlyph, ByteBuffer buffer) {
+        logger.resumeCount("GETGLYPHBOUNDINGBOXES");
+        fnt.getGlyphBoundingBoxes(firstGlyph, buffer);
+        logger.suspendCount("GETGLYPHBOUNDINGBOXES");
     }
 
-    public float[] getGlyphBoundingBox(int glyph) {
-        logger.resumeCount("GETGLYPHBOUNDINGBOX");
-        float[] res = fnt.getGlyphBoundingBox(glyph);
-        logger.suspendCount("GETGLYPHBOUNDINGBOX");
+    public String getFontFile() {
+        logger.resumeCount("GETFONTFILE");
+        String res = fnt.getFontFile();
+        logger.suspendCount("GETFONTFILE");
         return res;
     }
 
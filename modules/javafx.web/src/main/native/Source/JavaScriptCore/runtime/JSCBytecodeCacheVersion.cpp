@@ -31,7 +31,7 @@
 #include <wtf/NeverDestroyed.h>
 #include <wtf/text/SuperFastHash.h>
 
-#if !PLATFORM(JAVA)
+#if !PLATFORM(JAVA) || OS(LINUX)
 #if OS(UNIX)
 #include <dlfcn.h>
 #if OS(DARWIN)
@@ -70,7 +70,7 @@ uint32_t computeJSCBytecodeCacheVersion()
         }
         cacheVersion.construct(0);
         dataLogLnIf(JSCBytecodeCacheVersionInternal::verbose, "Failed to get UUID for JavaScriptCore framework");
-#elif OS(UNIX) && !PLATFORM(PLAYSTATION) && !OS(HAIKU) && !PLATFORM(JAVA)
+#elif OS(UNIX) && !PLATFORM(PLAYSTATION) && !OS(HAIKU) && (!PLATFORM(JAVA) || OS(LINUX))
         auto result = ([&] -> std::optional<uint32_t> {
             Dl_info info { };
             if (!dladdr(jsFunctionAddr, &info))
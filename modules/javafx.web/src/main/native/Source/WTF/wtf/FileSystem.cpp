@@ -429,7 +429,7 @@ std::optional<Salt> readOrMakeSalt(const String& path)
     return salt;
 }
 
-#if !PLATFORM(JAVA)
+#if !PLATFORM(JAVA) || OS(LINUX)
 std::optional<Vector<uint8_t>> readEntireFile(const String& path)
 {
     auto handle = FileSystem::openFile(path, FileSystem::FileOpenMode::Read);
@@ -108,6 +108,13 @@
 #include <wtf/PlatformEnableGlib.h>
 #endif
 
+/* --------- Java port --------- */
+#if PLATFORM(JAVA) && OS(LINUX)
+#if !defined(ENABLE_FILESYSTEM_POSIX_FAST_PATH)
+#define ENABLE_FILESYSTEM_POSIX_FAST_PATH 1
+#endif
+#endif
+
 /* ---------  ENABLE macro defaults --------- */
 
 /* Do not use PLATFORM() tests in this section ! */
@@ -95,6 +95,9 @@ elseif (UNIX)
         unix/LanguageUnix.cpp
         unix/MemoryPressureHandlerUnix.cpp
         linux/RealTimeThreads.cpp
+        posix/FileHandlePOSIX.cpp
+        posix/FileSystemPOSIX.cpp
+        posix/MappedFileDataPOSIX.cpp
     )
     list(APPEND WTF_LIBRARIES rt)
 elseif (WIN32)
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -41,10 +41,17 @@
     #include <unistd.h>
 #endif
 
+#if OS(LINUX)
+    #include <dirent.h>
+    #include <errno.h>
+    #include <stdio.h>
+#endif
+
 namespace WTF {
 
 namespace FileSystemImpl {
 
+#if !OS(LINUX)
 static inline bool isHandleValid(PlatformFileHandle handle)
 {
     return handle != invalidPlatformFileHandle;
@@ -624,6 +631,169 @@ int64_t readFromFile(PlatformFileHandle, std::span<uint8_t> data)
       return 0;
 }
 
+#else // OS(LINUX)
+
+// -----------------------------------------------------------------------
+//  On Linux the file system is accessed natively. FileHandle, openFile(),
+//  openTemporaryFile(), MappedFileData and the fast paths for fileExists(),
+//  deleteFile(), makeAllDirectories() and pathByAppendingComponent() come
+//  from the posix/ implementation shared with the other ports.
+// -----------------------------------------------------------------------
+enum class ShouldFollowSymbolicLinks : bool { No, Yes };
+static bool statFile(const String& path, struct stat& fileInfo, ShouldFollowSymbolicLinks shouldFollowSymbolicLinks)
+{
+    CString fsRep = fileSystemRepresentation(path);
+    if (fsRep.isNull() || !fsRep.length())
+        return false;
+
+    if (shouldFollowSymbolicLinks == ShouldFollowSymbolicLinks::Yes)
+        return !stat(fsRep.data(), &fileInfo);
+    return !lstat(fsRep.data(), &fileInfo);
+}
+
+static WallTime modificationTime(const struct stat& fileInfo)
+{
+    return WallTime::fromRawSeconds(fileInfo.st_mtim.tv_sec + fileInfo.st_mtim.tv_nsec / 1.0e9);
+}
+
+static FileType fileTypeForMode(mode_t mode)
+{
+    if (S_ISDIR(mode))
+        return FileType::Directory;
+    if (S_ISLNK(mode))
+        return FileType::SymbolicLink;
+    return FileType::Regular;
+}
+
+std::optional<uint64_t> fileSize(const String& path)
+{
+    struct stat fileInfo;
+    if (!statFile(path, fileInfo, ShouldFollowSymbolicLinks::Yes))
+        return std::nullopt;
+    return fileInfo.st_size;
+}
+
+std::optional<FileMetadata> fileMetadata(const String& path)
+{
+    struct stat fileInfo;
+    if (!statFile(path, fileInfo, ShouldFollowSymbolicLinks::Yes))
+        return { };
+
+    FileMetadata metadata {};
+    metadata.modificationTime = modificationTime(fileInfo);
+    metadata.length = fileInfo.st_size;
+    metadata.isHidden = isHiddenFile(path);
+    metadata.type = S_ISDIR(fileInfo.st_mode) ? FileMetadata::Type::Directory : FileMetadata::Type::File;
+    return metadata;
+}
+
+std::optional<WallTime> fileModificationTime(const String& path)
+{
+    struct stat fileInfo;
+    if (!statFile(path, fileInfo, ShouldFollowSymbolicLinks::Yes))
+        return std::nullopt;
+    return modificationTime(fileInfo);
+}
+
+std::optional<FileType> fileType(const String& path)
+{
+    struct stat fileInfo;
+    if (!statFile(path, fileInfo, ShouldFollowSymbolicLinks::No))
+        return std::nullopt;
+    return fileTypeForMode(fileInfo.st_mode);
+}
+
+std::optional<FileType> fileTypeFollowingSymlinks(const String& path)
+{
+    struct stat fileInfo;
+    if (!statFile(path, fileInfo, ShouldFollowSymbolicLinks::Yes))
+        return std::nullopt;
+    return fileTypeForMode(fileInfo.st_mode);
+}
+
+String pathFileName(const String& path)
+{
+    return path.substring(path.reverseFind('/') + 1);
+}
+
+String parentPath(const String& path)
+{
+    size_t separator = path.reverseFind('/');
+    if (separator == notFound)
+        return emptyString();
+    if (!separator)
+        return "/"_s;
+    return path.left(separator);
+}
+
+bool isHiddenFile(const String& path)
+{
+    return pathFileName(path).startsWith('.');
+}
+
+Vector<String> listDirectory(const String& path)
+{
+    Vector<String> fileNames;
+    DIR* directory = opendir(fileSystemRepresentation(path).data());
+    if (!directory)
+        return fileNames;
+
+    while (auto* entry = readdir(directory)) {
+        const char* name = entry->d_name;
+        if (!strcmp(name, ".") || !strcmp(name, ".."))
+            continue;
+        fileNames.append(stringFromFileSystemRepresentation(name));
+    }
+    closedir(directory);
+    return fileNames;
+}
+
+bool deleteEmptyDirectory(const String& path)
+{
+    return !rmdir(fileSystemRepresentation(path).data());
+}
+
+bool deleteNonEmptyDirectory(const String& path)
+{
+    for (auto& fileName : listDirectory(path)) {
+        auto childPath = pathByAppendingComponent(path, fileName);
+        if (fileType(childPath) == FileType::Directory)
+            deleteNonEmptyDirectory(childPath);
+        else
+            deleteFile(childPath);
+    }
+    return deleteEmptyDirectory(path);
+}
+
+bool copyFile(const String& targetPath, const String& sourcePath)
+{
+    auto handle = openFile(targetPath, FileOpenMode::Truncate);
+    return handle && handle.appendFileContents(sourcePath);
+}
+
+bool moveFile(const String& oldPath, const String& newPath)
+{
+    if (!rename(fileSystemRepresentation(oldPath).data(), fileSystemRepresentation(newPath).data()))
+        return true;
+
+    // Fall back to copying and then deleting source as rename() does not work across volumes.
+    if (errno != EXDEV || fileType(oldPath) != FileType::Regular)
+        return false;
+    return copyFile(newPath, oldPath) && deleteFile(oldPath);
+}
+
+bool hardLink(const String& targetPath, const String& linkPath)
+{
+    return !link(fileSystemRepresentation(targetPath).data(), fileSystemRepresentation(linkPath).data());
+}
+
+bool hardLinkOrCopyFile(const String& targetPath, const String& linkPath)
+{
+    return hardLink(targetPath, linkPath) || copyFile(linkPath, targetPath);
+}
+
+#endif // OS(LINUX)
+
 FileHandle createDumpFile(StringView filename, StringView extension, StringView path)
 {
     if (path.isEmpty()) {
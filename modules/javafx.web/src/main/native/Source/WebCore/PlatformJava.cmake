@@ -55,6 +55,15 @@ elseif (APPLE)
     )
 endif ()
 
+if (USE_JAVA_FREETYPE)
+    list(APPEND WebCore_SYSTEM_INCLUDE_DIRECTORIES
+        ${FREETYPE_INCLUDE_DIRS}
+    )
+    list(APPEND WebCore_LIBRARIES
+        ${FREETYPE_LIBRARIES}
+    )
+endif ()
+
 #FIXME: Workaround
 list(APPEND WebCoreTestSupport_LIBRARIES ${SQLite3_LIBRARIES})
 
@@ -87,6 +96,7 @@ if (USE_SYSTEM_MALLOC)
 endif ()
 
 list(APPEND WebCore_PRIVATE_FRAMEWORK_HEADERS
+    bindings/java/BytecodeCacheJava.h
     bindings/java/JavaDOMUtils.h
     bindings/java/JavaEventListener.h
     bindings/java/EventListenerManager.h
@@ -99,13 +109,13 @@ list(APPEND WebCore_PRIVATE_FRAMEWORK_HEADERS
     platform/graphics/java/PathJava.h
     platform/graphics/java/RQRef.h
     platform/graphics/java/RenderingQueue.h
-    platform/graphics/texmap/BitmapTextureJava.h
     platform/graphics/texmap/TextureMapperJava.h
     platform/graphics/texmap/TextureMapperJavaAdapter.h
     platform/java/DataObjectJava.h
     platform/java/PageSupplementJava.h
     platform/java/PlatformJavaClasses.h
     platform/java/PluginWidgetJava.h
+    platform/java/StringJava.h
     platform/mock/GeolocationClientMock.h
     platform/network/java/AuthenticationChallenge.h
     platform/network/java/CertificateInfo.h
@@ -0,0 +1,218 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "config.h"
+#include "BytecodeCacheJava.h"
+
+#include "CommonVM.h"
+#include <JavaScriptCore/BytecodeCacheError.h>
+#include <JavaScriptCore/CachedTypes.h>
+#include <wtf/CheckedArithmetic.h>
+#include <wtf/FileHandle.h>
+#include <wtf/FileSystem.h>
+#include <wtf/HashSet.h>
+#include <wtf/HexNumber.h>
+#include <wtf/MainThread.h>
+#include <wtf/MappedFileData.h>
+#include <wtf/NeverDestroyed.h>
+#include <wtf/Scope.h>
+#include <wtf/text/MakeString.h>
+
+namespace WebCore {
+
+static String& cacheDirectory()
+{
+    static NeverDestroyed<String> directory;
+    return directory.get();
+}
+
+// Caches holding bytecode that has not been written out yet.
+static HashSet<const BytecodeCacheJava*>& pendingCaches()
+{
+    static NeverDestroyed<HashSet<const BytecodeCacheJava*>> caches;
+    return caches.get();
+}
+
+static String directoryForProvider(const JSC::SourceProvider& provider)
+{
+    // Writing and mapping the cache files needs the native FileHandle,
+    // which the Java port only has on Linux.
+#if OS(LINUX)
+    if (isMainThread() && !provider.sourceOrigin().url().isEmpty())
+        return cacheDirectory();
+#else
+    UNUSED_PARAM(provider);
+#endif
+    return { };
+}
+
+static unsigned& loadedCacheCount()
+{
+    static unsigned count = 0;
+    return count;
+}
+
+void BytecodeCacheJava::setDirectory(const String& directory)
+{
+    ASSERT(isMainThread());
+#if OS(LINUX)
+    // Writing the cache files creates them, but not the directory they are in.
+    if (!directory.isEmpty() && !FileSystem::makeAllDirectories(directory)) {
+        cacheDirectory() = { };
+        return;
+    }
+#endif
+    cacheDirectory() = directory;
+}
+
+unsigned BytecodeCacheJava::loadedCacheFileCount()
+{
+    ASSERT(isMainThread());
+    return loadedCacheCount();
+}
+
+void BytecodeCacheJava::commitPendingUpdates()
+{
+    ASSERT(isMainThread());
+    for (auto* cache : copyToVector(pendingCaches()))
+        cache->commitCachedBytecode();
+}
+
+BytecodeCacheJava::BytecodeCacheJava(const JSC::SourceProvider& provider)
+    : m_provider(provider)
+    , m_directory(directoryForProvider(provider))
+{
+}
+
+BytecodeCacheJava::~BytecodeCacheJava()
+{
+    if (isEnabled())
+        pendingCaches().remove(this);
+}
+
+RefPtr<JSC::CachedBytecode> BytecodeCacheJava::cachedBytecode() const
+{
+    if (!m_didLoadBytecode)
+        loadBytecode();
+    return m_cachedBytecode;
+}
+
+void BytecodeCacheJava::cacheBytecode(const JSC::BytecodeCacheGenerator& generator) const
+{
+    if (!isEnabled())
+        return;
+    if (!m_cachedBytecode)
+        m_cachedBytecode = JSC::CachedBytecode::create();
+    if (auto update = generator()) {
+        m_cachedBytecode->addGlobalUpdate(update.releaseNonNull());
+        m_hasGlobalUpdate = true;
+        pendingCaches().add(this);
+    }
+}
+
+void BytecodeCacheJava::updateCache(const JSC::UnlinkedFunctionExecutable* executable, JSC::CodeSpecializationKind kind, const JSC::UnlinkedFunctionCodeBlock* codeBlock) const
+{
+    if (!isEnabled() || !m_cachedBytecode)
+        return;
+    JSC::BytecodeCacheError error;
+    RefPtr<JSC::CachedBytecode> cachedBytecode = JSC::encodeFunctionCodeBlock(commonVM(), codeBlock, error);
+    if (cachedBytecode && !error.isValid()) {
+        m_cachedBytecode->addFunctionUpdate(executable, kind, cachedBytecode.releaseNonNull());
+        pendingCaches().add(this);
+    }
+}
+
+void BytecodeCacheJava::commitCachedBytecode() const
+{
+    if (!isEnabled() || !m_cachedBytecode || !m_cachedBytecode->hasUpdates())
+        return;
+
+    pendingCaches().remove(this);
+    auto clearBytecode = makeScopeExit([&] {
+        m_cachedBytecode = nullptr;
+        m_hasGlobalUpdate = false;
+    });
+
+    auto writeUpdates = [&](FileSystem::FileHandle& handle) {
+        if (!handle.truncate(m_cachedBytecode->sizeForUpdate()))
+            return false;
+        bool success = true;
+        m_cachedBytecode->commitUpdates([&] (off_t offset, std::span<const uint8_t> data) {
+            success = success && handle.seek(offset, FileSystem::FileSeekOrigin::Beginning) && handle.write(data) == data.size();
+        });
+        return success;
+    };
+
+    if (m_hasGlobalUpdate) {
+        // The file may still be mapped by scripts decoded from it, so a new
+        // cache is written aside and moved over it instead of rewritten.
+        auto [temporaryPath, handle] = FileSystem::openTemporaryFile("bytecode"_s, { }, m_directory);
+        if (!handle)
+            return;
+        if (writeUpdates(handle) && FileSystem::moveFile(temporaryPath, cachePath()))
+            return;
+        FileSystem::deleteFile(temporaryPath);
+        return;
+    }
+
+    auto handle = FileSystem::openFile(cachePath(), FileSystem::FileOpenMode::ReadWrite, FileSystem::FileAccessPermission::User);
+    if (!handle)
+        return;
+
+    auto fileSize = handle.size();
+    size_t cacheFileSize;
+    if (!fileSize || !WTF::convertSafely(*fileSize, cacheFileSize) || cacheFileSize != m_cachedBytecode->size()) {
+        // Another page has updated the file since it was loaded.
+        return;
+    }
+
+    writeUpdates(handle);
+}
+
+String BytecodeCacheJava::cachePath() const
+{
+    return FileSystem::pathByAppendingComponent(m_directory,
+        makeString(hex(m_provider.sourceOrigin().url().string().hash(), 8), '-', hex(m_provider.hash(), 8), ".bytecode-cache"_s));
+}
+
+void BytecodeCacheJava::loadBytecode() const
+{
+    m_didLoadBytecode = true;
+    if (!isEnabled())
+        return;
+
+    auto handle = FileSystem::openFile(cachePath(), FileSystem::FileOpenMode::Read);
+    if (!handle)
+        return;
+
+    auto mappedFileData = handle.map(FileSystem::MappedFileMode::Private);
+    if (!mappedFileData)
+        return;
+
+    m_cachedBytecode = JSC::CachedBytecode::create(WTF::move(*mappedFileData));
+    ++loadedCacheCount();
+}
+
+} // namespace WebCore
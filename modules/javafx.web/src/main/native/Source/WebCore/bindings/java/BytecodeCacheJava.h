@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#pragma once
+
+#include <JavaScriptCore/CachedBytecode.h>
+#include <JavaScriptCore/SourceProvider.h>
+#include <wtf/Noncopyable.h>
+#include <wtf/text/WTFString.h>
+
+namespace WebCore {
+
+// Stores the bytecode JavaScriptCore generates for a script in a file
+// named after the script URL and source hash, and maps it back in when
+// the same script is evaluated again. JavaScriptCore rejects files written
+// by a different build through JSCBytecodeCacheVersion.
+class BytecodeCacheJava {
+    WTF_MAKE_NONCOPYABLE(BytecodeCacheJava);
+public:
+    explicit BytecodeCacheJava(const JSC::SourceProvider&);
+    ~BytecodeCacheJava();
+
+    // An empty directory disables the cache for scripts loaded afterwards.
+    // The directory is created if it does not exist yet.
+    static void setDirectory(const String&);
+    // Number of cache files mapped in so far, for testing.
+    static unsigned loadedCacheFileCount();
+    // Writes out the bytecode generated since the scripts were loaded.
+    static void commitPendingUpdates();
+
+    RefPtr<JSC::CachedBytecode> cachedBytecode() const;
+    void cacheBytecode(const JSC::BytecodeCacheGenerator&) const;
+    void updateCache(const JSC::UnlinkedFunctionExecutable*, JSC::CodeSpecializationKind, const JSC::UnlinkedFunctionCodeBlock*) const;
+    void commitCachedBytecode() const;
+
+private:
+    String cachePath() const;
+    void loadBytecode() const;
+
+    bool isEnabled() const { return !m_directory.isEmpty(); }
+
+    const JSC::SourceProvider& m_provider;
+    const String m_directory;
+    mutable bool m_didLoadBytecode { false };
+    mutable bool m_hasGlobalUpdate { false };
+    mutable RefPtr<JSC::CachedBytecode> m_cachedBytecode;
+};
+
+} // namespace WebCore
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2017, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -1246,6 +1246,32 @@ public class ElementImpl extends NodeImpl implements Element {
         , String selectors);
 
 
+// Batched queries
+    /**
+     * Returns the qualified names and values of all attributes of this
+     * element in a single call, as {@code name0, value0, name1, value1, ...}.
+     */
+    public String[] getAttributeNamesAndValues()
+    {
+        return getAttributeNamesAndValuesImpl(getPeer());
+    }
+    native static String[] getAttributeNamesAndValuesImpl(long peer);
+
+
+    /**
+     * Returns the subtree rooted at this element serialized as JSON in one
+     * pass. Every element is written as an object with {@code tag},
+     * {@code attributes}, {@code rect} ({@code [x, y, width, height]} of
+     * its bounding client rect) and {@code children}; text nodes are written
+     * as {@code {"text": ...}}. Layout is updated at most once.
+     */
+    public String getSubtreeSnapshot()
+    {
+        return getSubtreeSnapshotImpl(getPeer());
+    }
+    native static String getSubtreeSnapshotImpl(long peer);
+
+
 
 //stubs
     public void setIdAttribute(String name, boolean isId) throws DOMException {
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2017, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -94,5 +94,18 @@ public class NodeListImpl implements NodeList {
         , int index);
 
 
+// Batched queries
+    /**
+     * Returns the bounding client rects of all nodes of this list as
+     * {@code x, y, width, height} quadruples, zeros for nodes that are not
+     * elements. Layout is updated at most once for the whole list.
+     */
+    public double[] getBoundingClientRects()
+    {
+        return getBoundingClientRectsImpl(getPeer());
+    }
+    native static double[] getBoundingClientRectsImpl(long peer);
+
+
 }
 
@@ -61,6 +61,63 @@ static jchar toJCharValue(const JSValue& value, JSGlobalObject* globalObject)
     return (jchar)value.toNumber(globalObject);
 }
 
+template<typename T, typename ArrayType>
+static jobject toJavaArray(const Vector<jvalue>& values, ArrayType (JNIEnv::*newArray)(jsize), void (JNIEnv::*setRegion)(ArrayType, jsize, jsize, const T*), T jvalue::*member)
+{
+    JNIEnv* env = getJNIEnv();
+    ArrayType array = (env->*newArray)(values.size());
+    if (WTF::CheckAndClearException(env) || !array) // OOME
+        return nullptr;
+    auto elements = WTF::map(values, [member](const jvalue& value) {
+        return value.*member;
+    });
+    (env->*setRegion)(array, 0, elements.size(), elements.span().data());
+    return array;
+}
+
+// Converts a JavaScript array to a Java array of primitives, with a single
+// copy into the Java heap rather than one JNI call per element.
+static jobject convertJSArrayToJavaArray(JSGlobalObject* globalObject, RootObject* rootObject, JSArray* jsArray, const char* javaClassName)
+{
+    if (strlen(javaClassName) != 2 || javaClassName[0] != '[')
+        return nullptr;
+    JavaType elementType = javaTypeFromPrimitiveType(javaClassName[1]);
+
+    // Elements may be getters, and so may the valueOf of each element.
+    VM& vm = globalObject->vm();
+    auto scope = DECLARE_THROW_SCOPE(vm);
+    unsigned length = jsArray->length();
+    Vector<jvalue> values;
+    values.reserveInitialCapacity(length);
+    for (unsigned i = 0; i < length; i++) {
+        JSValue element = jsArray->getIndex(globalObject, i);
+        RETURN_IF_EXCEPTION(scope, nullptr);
+        values.append(convertValueToJValue(globalObject, rootObject, element, elementType, ""));
+        RETURN_IF_EXCEPTION(scope, nullptr);
+    }
+
+    switch (elementType) {
+    case JavaTypeBoolean:
+        return toJavaArray(values, &JNIEnv::NewBooleanArray, &JNIEnv::SetBooleanArrayRegion, &jvalue::z);
+    case JavaTypeByte:
+        return toJavaArray(values, &JNIEnv::NewByteArray, &JNIEnv::SetByteArrayRegion, &jvalue::b);
+    case JavaTypeChar:
+        return toJavaArray(values, &JNIEnv::NewCharArray, &JNIEnv::SetCharArrayRegion, &jvalue::c);
+    case JavaTypeShort:
+        return toJavaArray(values, &JNIEnv::NewShortArray, &JNIEnv::SetShortArrayRegion, &jvalue::s);
+    case JavaTypeInt:
+        return toJavaArray(values, &JNIEnv::NewIntArray, &JNIEnv::SetIntArrayRegion, &jvalue::i);
+    case JavaTypeLong:
+        return toJavaArray(values, &JNIEnv::NewLongArray, &JNIEnv::SetLongArrayRegion, &jvalue::j);
+    case JavaTypeFloat:
+        return toJavaArray(values, &JNIEnv::NewFloatArray, &JNIEnv::SetFloatArrayRegion, &jvalue::f);
+    case JavaTypeDouble:
+        return toJavaArray(values, &JNIEnv::NewDoubleArray, &JNIEnv::SetDoubleArrayRegion, &jvalue::d);
+    default:
+        return nullptr;
+    }
+}
+
 jobject convertUndefinedToJObject()
 {
     static JGObject jgoUndefined;
@@ -115,6 +172,8 @@ jvalue convertValueToJValue(JSGlobalObject* globalObject, RootObject* rootObject
                         return result;
                     }
                     result.l = array->javaArray();
+                } else if (javaType == JavaTypeArray && isJSArray(object)) {
+                    result.l = convertJSArrayToJavaArray(globalObject, rootObject, asArray(object), javaClassName);
                 } else if ((!result.l && (!strcmp(javaClassName, "java.lang.Object")))
                            || (!strcmp(javaClassName, "netscape.javascript.JSObject"))) {
                     // Wrap objects in JSObject instances.
@@ -380,6 +439,108 @@ jthrowable dispatchJNICall(int count, RootObject*, jobject obj, bool isStatic, J
     return ex;
 }
 
+static jclass utilitiesClass(JNIEnv* env)
+{
+    static JGClass utilitiesCls(env->FindClass("com/sun/webkit/Utilities"));
+    ASSERT(utilitiesCls);
+    return utilitiesCls;
+}
+
+bool canInvokeDirectly(jobject obj, jmethodID methodId)
+{
+    // Since obj is WeakGlobalRef, creating a localref to safeguard instance() from GC
+    JLObject jlinstance(obj, true);
+    if (!jlinstance || !methodId)
+        return false;
+
+    JNIEnv* env = getJNIEnv();
+    static jmethodID canInvokeDirectlyID = env->GetStaticMethodID(utilitiesClass(env),
+        "fwkCanInvokeDirectly", "(Ljava/lang/reflect/Method;)Z");
+    ASSERT(canInvokeDirectlyID);
+
+    JLClass objClass(env->GetObjectClass(jlinstance));
+    JLObject rmethod(env->ToReflectedMethod(objClass, methodId, false));
+    if (!rmethod) {
+        env->ExceptionClear();
+        return false;
+    }
+    jboolean result = env->CallStaticBooleanMethod(utilitiesClass(env), canInvokeDirectlyID, (jobject)rmethod);
+    if (WTF::CheckAndClearException(env))
+        return false;
+    return jbool_to_bool(result);
+}
+
+bool isSecurityManagerInstalled()
+{
+    JNIEnv* env = getJNIEnv();
+    static jmethodID isSecurityManagerInstalledID = env->GetStaticMethodID(utilitiesClass(env),
+        "fwkIsSecurityManagerInstalled", "()Z");
+    ASSERT(isSecurityManagerInstalledID);
+
+    jboolean result = env->CallStaticBooleanMethod(utilitiesClass(env), isSecurityManagerInstalledID);
+    if (WTF::CheckAndClearException(env))
+        return true;
+    return jbool_to_bool(result);
+}
+
+jthrowable invokeDirectly(jobject obj, JavaType returnType, jmethodID methodId, jvalue* args, jvalue& result)
+{
+    // Since obj is WeakGlobalRef, creating a localref to safeguard instance() from GC
+    JLObject jlinstance(obj, true);
+
+    if (!jlinstance) {
+        LOG_ERROR("Could not get javaInstance for %p in JNIUtilityPrivate::invokeDirectly", (jobject)jlinstance);
+        return NULL;
+    }
+
+    switch (returnType) {
+    case JavaTypeVoid:
+        callJNIMethodIDA<void>(jlinstance, methodId, args);
+        break;
+    case JavaTypeArray:
+    case JavaTypeObject:
+        result.l = callJNIMethodIDA<jobject>(jlinstance, methodId, args);
+        break;
+    case JavaTypeChar: {
+        // Boxed like the reflective call does, see dispatchJNICall.
+        jvalue value;
+        value.c = callJNIMethodIDA<jchar>(jlinstance, methodId, args);
+        JNIEnv* env = getJNIEnv();
+        result.l = env->ExceptionCheck() ? nullptr : jvalueToJObject(value, JavaTypeChar);
+        break;
+    }
+    case JavaTypeBoolean:
+        result.z = callJNIMethodIDA<jboolean>(jlinstance, methodId, args);
+        break;
+    case JavaTypeByte:
+        result.b = callJNIMethodIDA<jbyte>(jlinstance, methodId, args);
+        break;
+    case JavaTypeShort:
+        result.s = callJNIMethodIDA<jshort>(jlinstance, methodId, args);
+        break;
+    case JavaTypeInt:
+        result.i = callJNIMethodIDA<jint>(jlinstance, methodId, args);
+        break;
+    case JavaTypeLong:
+        result.j = callJNIMethodIDA<jlong>(jlinstance, methodId, args);
+        break;
+    case JavaTypeFloat:
+        result.f = callJNIMethodIDA<jfloat>(jlinstance, methodId, args);
+        break;
+    case JavaTypeDouble:
+        result.d = callJNIMethodIDA<jdouble>(jlinstance, methodId, args);
+        break;
+    case JavaTypeInvalid:
+        /* Nothing to do */
+        break;
+    }
+
+    JNIEnv* env = getJNIEnv();
+    jthrowable ex = env->ExceptionOccurred();
+    env->ExceptionClear();
+    return ex;
+}
+
 } // end of namespace Bindings
 
 } // end of namespace JSC
@@ -41,6 +41,12 @@ class RootObject;
 jvalue convertValueToJValue(JSGlobalObject*, RootObject*, JSValue, JavaType, const char* javaClassName);
 jobject convertUndefinedToJObject();
 jthrowable dispatchJNICall(int, RootObject *rootObject, jobject, bool isStatic, JavaType returnType, jmethodID, jobject* args, jvalue& result, jobject accessControlContext);
+// Calling a method through JNI skips the checks dispatchJNICall makes, so it
+// is only allowed for the methods where those checks cannot fail, see
+// com.sun.webkit.Utilities.fwkCanInvokeDirectly().
+bool canInvokeDirectly(jobject, jmethodID);
+bool isSecurityManagerInstalled();
+jthrowable invokeDirectly(jobject, JavaType returnType, jmethodID, jvalue* args, jvalue& result);
 jobject jvalueToJObject(jvalue value, JavaType);
 
 } // namespace Bindings
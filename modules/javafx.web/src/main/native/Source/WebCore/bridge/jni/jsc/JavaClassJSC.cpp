@@ -32,42 +32,171 @@
 #include "JavaFieldJSC.h"
 #include "JavaMethodJSC.h"
 #include "JNIUtilityPrivate.h"
+#include "JobjectWrapper.h"
 #include <JavaScriptCore/Identifier.h>
 #include <JavaScriptCore/JSLock.h>
+#include <wtf/MainThread.h>
+#include <wtf/NeverDestroyed.h>
 
 using namespace JSC;
 using namespace JSC::Bindings;
 
-JavaClass::JavaClass(jobject anInstance, RootObject* rootObject, jobject accessControlContext)
+namespace {
+
+// Reflected metadata shared by all instances of a class. The class is held
+// through a weak global reference, so the entry does not keep it alive and
+// is dropped once it has been unloaded.
+//
+// Without a security manager reflection returns the same members whatever
+// the access control context, so the metadata is keyed by the class alone.
+// With one installed it is reflected per context, and contexts are compared
+// with AccessControlContext.equals() since every call from Java captures a
+// new one. Those are held strongly, as a weakly held one would be collected
+// right after the call, and only the last few per class are kept.
+struct CachedClass {
+    RefPtr<JobjectWrapper> javaClass;
+    RefPtr<JobjectWrapper> accessControlContext;
+    Ref<JavaClass> metadata;
+};
+
+constexpr size_t maxCachedContextsPerClass = 4;
+
+// Entries of unloaded classes are pruned once the cache has doubled since
+// the last time, so that misses do not scan it every time.
+constexpr size_t minPruneThreshold = 64;
+
+HashMap<String, Vector<CachedClass>>& classCache()
+{
+    static NeverDestroyed<HashMap<String, Vector<CachedClass>>> cache;
+    return cache;
+}
+
+size_t& cachedEntryCount()
+{
+    static size_t count = 0;
+    return count;
+}
+
+void removeUnloadedClasses(JNIEnv* env)
+{
+    static size_t pruneThreshold = minPruneThreshold;
+    if (cachedEntryCount() < pruneThreshold)
+        return;
+
+    classCache().removeIf([env](auto& entry) {
+        cachedEntryCount() -= entry.value.removeAllMatching([env](auto& cached) {
+            return env->IsSameObject(cached.javaClass->instance(), nullptr);
+        });
+        return entry.value.isEmpty();
+    });
+    pruneThreshold = std::max(minPruneThreshold, 2 * cachedEntryCount());
+}
+
+bool hasSecurityManager(JNIEnv* env)
+{
+    JLClass systemClass(env->FindClass("java/lang/System"));
+    static jmethodID getSecurityManagerMID = env->GetStaticMethodID(
+        systemClass, "getSecurityManager", "()Ljava/lang/SecurityManager;");
+    ASSERT(getSecurityManagerMID);
+
+    JLObject securityManager(env->CallStaticObjectMethod(systemClass, getSecurityManagerMID));
+    WTF::CheckAndClearException(env);
+    return !!securityManager;
+}
+
+bool isSameContext(const CachedClass& cached, jobject accessControlContext)
+{
+    if (!cached.accessControlContext || !accessControlContext)
+        return !cached.accessControlContext && !accessControlContext;
+    return callJNIMethod<jboolean>(cached.accessControlContext->instance(),
+        "equals", "(Ljava/lang/Object;)Z", accessControlContext);
+}
+
+} // namespace
+
+size_t JavaClass::cachedClassCount(const String& name)
+{
+    ASSERT(isMainThread());
+
+    auto it = classCache().find(name);
+    return it != classCache().end() ? it->value.size() : 0;
+}
+
+Ref<JavaClass> JavaClass::classForInstance(jobject anInstance, RootObject* rootObject, jobject accessControlContext)
 {
+    ASSERT(isMainThread());
+
     // Since anInstance is WeakGlobalRef, creating a localref to safeguard instance() from GC
     JLObject jlinstance(anInstance, true);
 
     if (!jlinstance) {
-        LOG_ERROR("Could not get javaInstance for %p in JavaClass Constructor", (jobject)jlinstance);
+        LOG_ERROR("Could not get javaInstance for %p in JavaClass::classForInstance", (jobject)jlinstance);
         anInstance = createDummyObject();
         if (anInstance == nullptr) {
-            LOG_ERROR("Could not createDummyObject for %p in JavaClass Constructor", anInstance);
-            m_name = fastStrDup("<Unknown>");
-            return;
+            LOG_ERROR("Could not createDummyObject for %p in JavaClass::classForInstance", anInstance);
+            return adoptRef(*new JavaClass("<Unknown>"));
         }
     }
 
-    jobject aClass = callJNIMethod<jobject>(anInstance, "getClass", "()Ljava/lang/Class;");
+    JLClass aClass(static_cast<jclass>(callJNIMethod<jobject>(anInstance, "getClass", "()Ljava/lang/Class;")));
 
     if (!aClass) {
         LOG_ERROR("Unable to call getClass on instance %p", anInstance);
-        m_name = fastStrDup("<Unknown>");
-        return;
+        return adoptRef(*new JavaClass("<Unknown>"));
     }
 
+    CString name;
     if (jstring className = (jstring)callJNIMethod<jobject>(aClass, "getName", "()Ljava/lang/String;")) {
         const char* classNameC = getCharactersFromJString(className);
-        m_name = fastStrDup(classNameC);
+        name = classNameC;
         releaseCharactersForJString(className, classNameC);
+        getJNIEnv()->DeleteLocalRef(className);
     } else
-        m_name = fastStrDup("<Unknown>");
+        return adoptRef(*new JavaClass(aClass, "<Unknown>", rootObject, accessControlContext));
 
+    // Classes of the same name may come from different class loaders.
+    JNIEnv* env = getJNIEnv();
+    bool keyedByContext = hasSecurityManager(env);
+    String key = String::fromUTF8(name.span());
+    auto it = classCache().find(key);
+    if (it != classCache().end()) {
+        for (auto& cached : it->value) {
+            if (env->IsSameObject(cached.javaClass->instance(), aClass)
+                && (!keyedByContext || isSameContext(cached, accessControlContext)))
+                return cached.metadata.copyRef();
+        }
+    }
+
+    removeUnloadedClasses(env);
+    Ref metadata = adoptRef(*new JavaClass(aClass, name.data(), rootObject, accessControlContext));
+    // Reflection that failed, e.g. because it was denied, is retried for the
+    // next instance rather than remembered.
+    if (!metadata->m_isComplete)
+        return metadata;
+
+    RefPtr<JobjectWrapper> cachedContext;
+    if (keyedByContext && accessControlContext)
+        cachedContext = JobjectWrapper::create(accessControlContext, true);
+    auto& entries = classCache().ensure(key, [] {
+        return Vector<CachedClass>();
+    }).iterator->value;
+    if (keyedByContext && entries.size() >= maxCachedContextsPerClass) {
+        entries.removeAt(0);
+        --cachedEntryCount();
+    }
+    entries.append({ JobjectWrapper::create(aClass), WTF::move(cachedContext), metadata.copyRef() });
+    ++cachedEntryCount();
+    return metadata;
+}
+
+JavaClass::JavaClass(const char* name)
+    : m_name(fastStrDup(name))
+{
+}
+
+JavaClass::JavaClass(jclass aClass, const char* name, RootObject* rootObject, jobject accessControlContext)
+    : m_name(fastStrDup(name))
+{
     int i;
     JNIEnv* env = getJNIEnv();
 
@@ -75,8 +204,10 @@ JavaClass::JavaClass(jobject anInstance, RootObject* rootObject, jobject accessC
     jvalue result;
     jobject args[1];
     jmethodID methodId = getMethodID(aClass, "getFields", "()[Ljava/lang/reflect/Field;");
+    bool reflectedFields = false;
     if (dispatchJNICall(0, rootObject, aClass, false, JavaTypeArray, methodId,
                         args, result, accessControlContext) == nullptr) {
+        reflectedFields = true;
         jarray fields = (jarray) result.l;
         int numFields = env->GetArrayLength(fields);
         for (i = 0; i < numFields; i++) {
@@ -116,7 +247,9 @@ JavaClass::JavaClass(jobject anInstance, RootObject* rootObject, jobject accessC
         env->DeleteLocalRef(methods);
     }
 
-    env->DeleteLocalRef(aClass);
+    // Every class has the public methods of Object, so no methods at all
+    // means that reflection did not succeed.
+    m_isComplete = reflectedFields && !m_methods.isEmpty();
 }
 
 JavaClass::~JavaClass()
@@ -170,6 +303,9 @@ Method* JavaClass::methodNamed(PropertyName propertyName, Instance*) const
     size_t i;
     if (nameLength >= 3 && name[nameLength-1] == ')'
         && (i = name.find('(', 1)) != WTF::notFound) {
+        auto cached = m_methodsBySignature.find(name);
+        if (cached != m_methodsBySignature.end())
+            return cached->value;
         Vector<String> pnames;
         size_t pstart = i + 1;
         if (pstart < nameLength-1) {
@@ -258,6 +394,10 @@ Method* JavaClass::methodNamed(PropertyName propertyName, Instance*) const
                 }
             }
         }
+        Method* method = methodList ? methodList->at(0) : nullptr;
+        delete methodList;
+        m_methodsBySignature.add(name, method);
+        return method;
     } else {
         methodList = m_methods.get(name.impl());
     }
@@ -30,14 +30,20 @@
 #include "BridgeJSC.h"
 #include "JNIUtility.h"
 #include <wtf/HashMap.h>
+#include <wtf/RefCounted.h>
 
 namespace JSC {
 
 namespace Bindings {
 
-class JavaClass : public Class {
+class JavaClass : public Class, public RefCounted<JavaClass> {
 public:
-    JavaClass(jobject, RootObject*, jobject accessControlContext);
+    // Returns the metadata of the class of the given instance. The metadata
+    // is reflected once per class and shared by all of its instances.
+    static Ref<JavaClass> classForInstance(jobject, RootObject*, jobject accessControlContext);
+    // Number of cached metadata entries for classes of the given name, for
+    // testing.
+    static size_t cachedClassCount(const String& name);
     ~JavaClass();
 
     virtual Method* methodNamed(PropertyName, Instance*) const;
@@ -57,10 +63,16 @@ private:
     struct wpe_renderer_backend_egl* m_backend { nullptr };
 #endif
 #if PLATFORM(JAVA)
-    jobject createDummyObject();
+    explicit JavaClass(const char* name);
+    JavaClass(jclass, const char* name, RootObject*, jobject accessControlContext);
+
+    static jobject createDummyObject();
     const char* m_name;
         mutable FieldMap m_fields;
         mutable MethodListMap m_methods;
+    // Overloads selected by an explicit "name(type,...)" signature.
+    mutable HashMap<String, Method*> m_methodsBySignature;
+    bool m_isComplete { false };
 #endif
 };
 
@@ -66,6 +66,28 @@ JavaField::JavaField(JNIEnv* env, jobject aField)
     env->DeleteLocalRef(fieldName);
 
     m_field = JobjectWrapper::create(aField);
+    m_fieldID = env->FromReflectedField(aField);
+    m_isStatic = (callJNIMethod<jint>(aField, "getModifiers", "()I") & 0x8) != 0;
+}
+
+// The Field object is only weakly referenced, and JavaClass metadata is shared
+// by all instances of a class for as long as the class is loaded. Recreate the
+// Field from its ID once it has been collected.
+jobject JavaField::reflectedField(const JavaInstance* instance) const
+{
+    JNIEnv* env = getJNIEnv();
+    jobject jfield = env->NewLocalRef(m_field->instance());
+    if (jfield || !m_fieldID)
+        return jfield;
+
+    JLObject jlinstance(instance->javaInstance(), true);
+    if (!jlinstance)
+        return nullptr;
+    JLClass cls(env->GetObjectClass(jlinstance));
+    jfield = env->ToReflectedField(cls, m_fieldID, m_isStatic);
+    if (jfield)
+        m_field = JobjectWrapper::create(jfield);
+    return jfield;
 }
 
 JSValue JavaField::valueFromInstance(JSGlobalObject* globalObject, const Instance* i) const
@@ -73,9 +95,8 @@ JSValue JavaField::valueFromInstance(JSGlobalObject* globalObject, const Instanc
     const JavaInstance* instance = static_cast<const JavaInstance*>(i);
 
     JSValue jsresult = jsUndefined();
-    jobject jfield = m_field->instance();
-    // Since jfield is WeakGlobalRef, creating a localref to safeguard instance() from GC
-    JLObject jlfield(jfield, true);
+    JLObject jlfield(reflectedField(instance));
+    jobject jfield = jlfield;
 
     if (!jlfield) {
         LOG_ERROR("Could not get javaInstance for %p in JavaField::valueFromInstance", (jobject)jlfield);
@@ -156,9 +177,8 @@ bool JavaField::setValueToInstance(JSGlobalObject* globalObject, const Instance*
     LOG(LiveConnect, "JavaField::setValueToInstance setting value %s to %s", String(name().impl()).utf8().data(), aValue.toString(globalObject)->value(globalObject).ascii().data());
 #endif
 
-    jobject jfield = m_field->instance();
-    // Since jfield is WeakGlobalRef, creating a localref to safeguard instance() from GC
-    JLObject jlfield(jfield, true);
+    JLObject jlfield(reflectedField(instance));
+    jobject jfield = jlfield;
 
     if (!jlfield) {
         LOG_ERROR("Could not get Instance for %p in JavaField::setValueToInstance", (jobject)jlfield);
@@ -37,6 +37,8 @@ namespace JSC {
 
 namespace Bindings {
 
+class JavaInstance;
+
 class JavaField : public Field {
 public:
     JavaField(JNIEnv*, jobject aField);
@@ -49,10 +51,14 @@ public:
     JavaType type() const { return m_type; }
 
 private:
+    jobject reflectedField(const JavaInstance*) const;
+
     JavaString m_name;
     JavaString m_typeClassName;
     JavaType m_type;
-    RefPtr<JobjectWrapper> m_field;
+    mutable RefPtr<JobjectWrapper> m_field;
+    jfieldID m_fieldID;
+    bool m_isStatic;
 };
 
 } // namespace Bindings
@@ -56,14 +56,10 @@ JavaInstance::JavaInstance(jobject instance, RefPtr<RootObject>&& rootObject, jo
     : Instance(WTF::move(rootObject))
 {
     m_instance = JobjectWrapper::create(instance);
-    m_class = 0;
     m_accessControlContext = JobjectWrapper::create(accessControlContext, true);
 }
 
-JavaInstance::~JavaInstance()
-{
-    delete m_class;
-}
+JavaInstance::~JavaInstance() = default;
 
 RuntimeObject* JavaInstance::newRuntimeObject(JSGlobalObject* globalObject)
 {
@@ -86,9 +82,9 @@ Class* JavaInstance::getClass() const
 {
     if (!m_class) {
         jobject acc = accessControlContext();
-        m_class = new JavaClass(m_instance->instance(), rootObject(), acc);
+        m_class = JavaClass::classForInstance(m_instance->instance(), rootObject(), acc);
     }
-    return m_class;
+    return m_class.get();
 }
 
 JSValue JavaInstance::stringValue(JSGlobalObject* globalObject) const
@@ -144,7 +140,13 @@ static JSValue numberValueForCharacter(jobject obj) {
         return jsUndefined();
     }
 
-    return jsNumber((int) callJNIMethod<jchar>(obj, "charValue", "()C"));
+    JNIEnv* env = getJNIEnv();
+    static JGClass characterClass(env->FindClass("java/lang/Character"));
+    static jmethodID charValueID = env->GetMethodID(characterClass, "charValue", "()C");
+    ASSERT(charValueID);
+    if (!env->IsInstanceOf(jlinstance, characterClass))
+        return jsNumber(0);
+    return jsNumber((int) callJNIMethodIDA<jchar>(jlinstance, charValueID, nullptr));
 }
 
 static JSValue numberValueForNumber(jobject obj) {
@@ -157,7 +159,24 @@ static JSValue numberValueForNumber(jobject obj) {
         return jsUndefined();
     }
 
-    return jsNumber(callJNIMethod<jdouble>(obj, "doubleValue", "()D"));
+    JNIEnv* env = getJNIEnv();
+    static JGClass numberClass(env->FindClass("java/lang/Number"));
+    static jmethodID doubleValueID = env->GetMethodID(numberClass, "doubleValue", "()D");
+    ASSERT(doubleValueID);
+    if (!env->IsInstanceOf(jlinstance, numberClass))
+        return jsNumber(0);
+    return jsNumber(callJNIMethodIDA<jdouble>(jlinstance, doubleValueID, nullptr));
+}
+
+static jboolean booleanValueForBoolean(jobject obj)
+{
+    JNIEnv* env = getJNIEnv();
+    static JGClass booleanClass(env->FindClass("java/lang/Boolean"));
+    static jmethodID booleanValueID = env->GetMethodID(booleanClass, "booleanValue", "()Z");
+    ASSERT(booleanValueID);
+    if (!env->IsInstanceOf(obj, booleanClass))
+        return JNI_FALSE;
+    return callJNIMethodIDA<jboolean>(obj, booleanValueID, nullptr);
 }
 
 
@@ -176,10 +195,7 @@ JSValue JavaInstance::numberValue(JSGlobalObject*) const
     if (aClass->isCharacterClass())
         return numberValueForCharacter(obj);
     if (aClass->isBooleanClass())
-        return jsNumber((int)
-                        // Replaced the following line to work around possible GCC bug, see RT-22725
-                    // callJNIMethod<jboolean>(obj, "booleanValue", "()Z"));
-                        callJNIMethod(obj, JavaTypeBoolean, "booleanValue", "()Z", 0).z);
+        return jsNumber((int) booleanValueForBoolean(jlinstance));
     return numberValueForNumber(obj);
 }
 
@@ -193,9 +209,7 @@ JSValue JavaInstance::booleanValue() const
         return jsUndefined();
     }
 
-    // Changed the call to work around possible GCC bug, see RT-22725
-    jboolean booleanValue = callJNIMethod(m_instance->instance(), JavaTypeBoolean, "booleanValue", "()Z", 0).z;
-    return jsBoolean(booleanValue);
+    return jsBoolean(booleanValueForBoolean(jlinstance));
 }
 
 class JavaRuntimeMethod : public RuntimeMethod {
@@ -307,14 +321,15 @@ JSValue JavaInstance::invokeMethod(JSGlobalObject* globalObject, CallFrame* call
         return jsUndefined();
     }
 
-    Vector<jobject> jArgs(count);
+    Vector<jvalue> jValues(count);
+    Vector<JavaType> jTypes(count);
 
     for (int i = 0; i < count; i++) {
         CString javaClassName = jMethod->parameterAt(i).utf8();
-        JavaType jtype = javaTypeFromClassName(javaClassName.data());
-        jvalue jarg = convertValueToJValue(globalObject, m_rootObject.get(),
-            callFrame->argument(i), jtype, javaClassName.data());
-        jArgs[i] = jvalueToJObject(jarg, jtype);
+        jTypes[i] = javaTypeFromClassName(javaClassName.data());
+        jValues[i] = convertValueToJValue(globalObject, m_rootObject.get(),
+            callFrame->argument(i), jTypes[i], javaClassName.data());
+        RETURN_IF_EXCEPTION(scope, jsUndefined());
 #if !PLATFORM(JAVA)
         LOG(LiveConnect, "JavaInstance::invokeMethod arg[%d] = %s", i, callFrame->argument(i).toString(globalObject)->value(globalObject).ascii().data());
 #endif
@@ -343,13 +358,24 @@ JSValue JavaInstance::invokeMethod(JSGlobalObject* globalObject, CallFrame* call
         }
 
         // const char *callingURL = 0; // FIXME, need to propagate calling URL to Java
-        jmethodID methodId = getMethodID(obj, jMethod->name().utf8().data(), jMethod->signature());
-
-        jthrowable ex = dispatchJNICall(callFrame->argumentCount(), rootObject,
-                                        obj, jMethod->isStatic(),
-                                        jMethod->returnType(), methodId,
-                                        jArgs.mutableSpan().data(), result,
-                                        accessControlContext());
+        jmethodID methodId = jMethod->methodID();
+        if (!methodId)
+            methodId = getMethodID(obj, jMethod->name().utf8().data(), jMethod->signature());
+
+        jthrowable ex;
+        if (methodId == jMethod->methodID() && jMethod->canInvokeDirectly(obj)) {
+            ex = invokeDirectly(obj, jMethod->returnType(), methodId,
+                                jValues.mutableSpan().data(), result);
+        } else {
+            Vector<jobject> jArgs(count, [&](size_t i) {
+                return jvalueToJObject(jValues[i], jTypes[i]);
+            });
+            ex = dispatchJNICall(callFrame->argumentCount(), rootObject,
+                                 obj, jMethod->isStatic(),
+                                 jMethod->returnType(), methodId,
+                                 jArgs.mutableSpan().data(), result,
+                                 accessControlContext());
+        }
         if (ex != NULL) {
             JSValue exceptionDescription
               = (JavaInstance::create(ex, rootObject, accessControlContext())
@@ -29,6 +29,7 @@
 
 #if ENABLE(JAVA_BRIDGE)
 
+#include "JNIUtilityPrivate.h"
 #include <JavaScriptCore/JSObject.h>
 #include <wtf/text/StringBuilder.h>
 
@@ -77,6 +78,16 @@ JavaMethod::JavaMethod(JNIEnv* env, jobject aMethod)
 
     jint modifiers = callJNIMethod<jint>(aMethod, "getModifiers", "()I");
     m_isStatic = (modifiers & 0x8) != 0;
+
+    m_methodID = env->FromReflectedMethod(aMethod);
+}
+
+bool JavaMethod::canInvokeDirectly(jobject instance) const
+{
+    if (m_dispatch == Dispatch::Unknown)
+        m_dispatch = JSC::Bindings::canInvokeDirectly(instance, m_methodID) ? Dispatch::Direct : Dispatch::Reflective;
+    // A security manager installed later brings the access checks back.
+    return m_dispatch == Dispatch::Direct && !isSecurityManagerInstalled();
 }
 
 JavaMethod::~JavaMethod()
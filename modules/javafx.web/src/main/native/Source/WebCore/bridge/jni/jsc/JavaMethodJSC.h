@@ -50,6 +50,11 @@ public:
     const char* signature() const;
     JavaType returnType() const { return m_returnType; }
     bool isStatic() const { return m_isStatic; }
+    // Stays valid as long as the declaring class is loaded.
+    jmethodID methodID() const { return m_methodID; }
+    // Whether the method may be called with methodID() through JNI instead
+    // of reflectively, see canInvokeDirectly() in JNIUtilityPrivate.h.
+    bool canInvokeDirectly(jobject instance) const;
 
     // Method implementation
     int numParameters() const { return m_parameters.size(); }
@@ -60,6 +65,9 @@ private:
     mutable char* m_signature;
     JavaString m_returnTypeClassName;
     JavaType m_returnType;
+    jmethodID m_methodID;
+    enum class Dispatch : uint8_t { Unknown, Direct, Reflective };
+    mutable Dispatch m_dispatch { Dispatch::Unknown };
     bool m_isStatic;
 };
 
@@ -61,6 +61,9 @@ WTF_IGNORE_WARNINGS_IN_THIRD_PARTY_CODE_END
 #if PLATFORM(JAVA)
 #include "PlatformJavaClasses.h"
 #include "RQRef.h"
+#if USE(JAVA_FREETYPE)
+#include "FreeTypeFaceJava.h"
+#endif
 #endif
 
 #if USE(APPKIT)
@@ -441,6 +444,9 @@ public:
 
 #if PLATFORM(JAVA)
     RefPtr<RQRef> nativeFontData() const { return m_jFont; }
+#if USE(JAVA_FREETYPE)
+    FreeTypeFaceJava* freeTypeFace() const { return m_freeTypeFace.get(); }
+#endif
 #endif
 
     unsigned hash() const;
@@ -537,6 +543,9 @@ private:
 
 #if PLATFORM(JAVA)
     RefPtr<RQRef> m_jFont;
+#if USE(JAVA_FREETYPE)
+    RefPtr<FreeTypeFaceJava> m_freeTypeFace;
+#endif
 #endif
 
     float m_size { 0 };
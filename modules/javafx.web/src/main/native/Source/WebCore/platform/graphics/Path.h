@@ -91,6 +91,9 @@ public:
     bool isEmpty() const;
     bool definitelySingleLine() const;
     WEBCORE_EXPORT PlatformPathPtr platformPath() const;
+#if PLATFORM(JAVA)
+    const PlatformPathImpl& platformPathImpl() const { return const_cast<Path&>(*this).ensurePlatformPathImpl(); }
+#endif
 #if USE(CG)
     WEBCORE_EXPORT RetainPtr<CGPathRef> protectedPlatformPath() const;
 #endif
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018, 2019, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2018, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -30,6 +30,7 @@
 #include "FontCascade.h"
 
 #include "PlatformJavaClasses.h"
+#include <wtf/Vector.h>
 #include <wtf/text/MakeString.h>
 
 namespace WebCore {
@@ -92,72 +93,42 @@ unsigned jGetEnd(jobject jRun)
     return env->CallIntMethod(jRun, mID);
 }
 
-unsigned jGetCharOffset(jobject jRun, unsigned glyphIndex)
+// Per glyph data as written by WCTextRun.getGlyphData().
+struct GlyphData {
+    jint glyph;
+    jint charOffset;
+    jfloat x;
+    jfloat y;
+    jfloat advance;
+};
+static_assert(sizeof(GlyphData) == 5 * sizeof(jint));
+
+// Fetches the data of all glyphs in the run with a single call instead of
+// a few calls per glyph.
+Vector<GlyphData> jGetGlyphData(jobject jRun, unsigned glyphCount)
 {
-    if (!jGetGlyphCount(jRun)) {
-        // Return same value as TextRun.getCharOffset() when there is
-        // no glyph information available.
-        return glyphIndex;
-    }
-
-    JNIEnv* env = WTF::GetJavaEnv();
-    static jmethodID mID = env->GetMethodID(
-        PG_GetTextRun(env),
-        "getCharOffset",
-        "(I)I");
-    ASSERT(mID);
-
-    return env->CallIntMethod(jRun, mID, glyphIndex);
-}
-
-CGGlyph jGetGlyph(jobject jRun, unsigned glyphIndex)
-{
-    JNIEnv* env = WTF::GetJavaEnv();
-    static jmethodID mID = env->GetMethodID(
-        PG_GetTextRun(env),
-        "getGlyph",
-        "(I)I");
-    ASSERT(mID);
-
-    return env->CallIntMethod(jRun, mID, glyphIndex);
-}
-
-FloatRect jGetGlyphPosAndAdvance(jobject jRun, unsigned glyphIndex)
-{
-    if (!jGetGlyphCount(jRun)) {
-        return { };
-    }
+    Vector<GlyphData> glyphs(glyphCount);
+    if (!glyphCount)
+        return glyphs;
 
     JNIEnv* env = WTF::GetJavaEnv();
     static jmethodID mID = env->GetMethodID(
         PG_GetTextRun(env),
-        "getGlyphPosAndAdvance",
-        "(I)[F");
+        "getGlyphData",
+        "(Ljava/nio/ByteBuffer;)V");
     ASSERT(mID);
 
-    JLocalRef<jfloatArray> jpos = static_cast<jfloatArray> (env->CallObjectMethod(
-                                                              jRun, mID, glyphIndex));
-    WTF::CheckAndClearException(env);
-
-    jfloat* pos = static_cast<float*>(env->GetPrimitiveArrayCritical(jpos, 0));
-    FloatRect rect = { pos[0], pos[1], pos[2], pos[3] };
-    env->ReleasePrimitiveArrayCritical(jpos, pos, 0);
-    return rect;
-}
-
-FloatSize jGetInitialAdvance(JLObject jRun)
-{
-    // FIXME(arajkumar): There is no way to get initial advance from Prism Font implementation.
-    // With trial and error I found that glyph 0's x,y position can be used as an alternative
-    // for initial advance.
-    return jGetGlyphPosAndAdvance(jRun, 0).location() - FloatPoint();
+    JLObject buffer(env->NewDirectByteBuffer(glyphs.mutableSpan().data(), glyphs.sizeInBytes()));
+    env->CallVoidMethod(jRun, mID, (jobject)buffer);
+    if (WTF::CheckAndClearException(env))
+        return Vector<GlyphData>(glyphCount, GlyphData { });
+    return glyphs;
 }
 
 }
 
 ComplexTextController::ComplexTextRun::ComplexTextRun(JLObject jRun, const Font& font, const UChar* characters, unsigned stringLocation, unsigned stringLength)
-    : m_initialAdvance(jGetInitialAdvance(jRun))
-    , m_font(font)
+    : m_font(font)
     , m_characters(characters, stringLength)
     , m_stringLength(stringLength)
     , m_indexBegin(jGetStart(jRun))
@@ -166,6 +137,14 @@ ComplexTextController::ComplexTextRun::ComplexTextRun(JLObject jRun, const Font&
     , m_stringLocation(stringLocation)
     , m_isLTR(jIsLTR(jobject(jRun)))
 {
+    auto glyphData = jGetGlyphData(jRun, m_glyphCount);
+
+    // FIXME(arajkumar): There is no way to get initial advance from Prism Font implementation.
+    // With trial and error I found that glyph 0's x,y position can be used as an alternative
+    // for initial advance.
+    if (!glyphData.isEmpty())
+        m_initialAdvance = { glyphData[0].x, glyphData[0].y };
+
     // Handle empty string runs (line breaks, etc.)
     if (m_stringLength == 0) {
         m_glyphCount = 0;
@@ -195,16 +174,15 @@ ComplexTextController::ComplexTextRun::ComplexTextRun(JLObject jRun, const Font&
         // java TextRun will have indicies relative to it's text. So it has to
         // be converted to absolute index w.r.t WebCore String.
         // Refer {CTGlyphLayout, DWGlyphLayout, PangoGlyphLayout}.layout()
-        m_coreTextIndices[i] = m_indexBegin + jGetCharOffset(jRun, i);
+        m_coreTextIndices[i] = m_indexBegin + glyphData[i].charOffset;
 
-        m_glyphs[i]= jGetGlyph(jRun, i);
+        m_glyphs[i] = glyphData[i].glyph;
         if (m_font->isZeroWidthSpaceGlyph(m_glyphs[i])) {
             m_baseAdvances[i] = { };
             continue;
         }
 
-        auto glyphBox = jGetGlyphPosAndAdvance(jRun, i);
-        m_baseAdvances[i] = glyphBox.size();
+        m_baseAdvances[i] = { glyphData[i].advance, 0 };
     }
 }
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2021, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -41,60 +41,18 @@ void FontCascade::drawGlyphs(GraphicsContext& context, const Font& font, std::sp
 const FloatPoint& point, FontSmoothingMode)
 {
     const unsigned numGlyphs = glyphs.size();
-    // we need to call freeSpace() before refIntArr() and refFloatArr(), see JDK-8127455.
-    RenderingQueue& rq = context.platformContext()->rq().freeSpace(24);
-
-    JNIEnv* env = WTF::GetJavaEnv();
-
-    //prepare Glyphs array
-    JLocalRef<jintArray> jGlyphs(env->NewIntArray(numGlyphs));
-    ASSERT(jGlyphs);
-    {
-        jint *bufArray = (jint*)env->GetPrimitiveArrayCritical(jGlyphs, NULL);
-        ASSERT(bufArray);
-        for (unsigned i = 0; i < numGlyphs; ++i)
-            bufArray[i] = static_cast<jint>(glyphs[i]); // glyphs[i] is a GlyphBufferGlyph
-        env->ReleasePrimitiveArrayCritical(jGlyphs, bufArray, 0);
-    }
-    static jmethodID refIntArr_mID = env->GetMethodID(
-        PG_GetRenderQueueClass(env),
-        "refIntArr",
-        "([I)I");
-    ASSERT(refIntArr_mID);
-    jint sid = env->CallIntMethod(
-        rq.getWCRenderingQueue(),
-        refIntArr_mID,
-        (jintArray)jGlyphs);
-    WTF::CheckAndClearException(env);
-
-
-    // Prepare Offsets/Advances array
-    JLocalRef<jfloatArray> jAdvance(env->NewFloatArray(numGlyphs));
-    WTF::CheckAndClearException(env);
-    ASSERT(jAdvance);
-    {
-        jfloat *bufArray = env->GetFloatArrayElements(jAdvance, NULL);
-        ASSERT(bufArray);
-        for (unsigned i = 0; i < numGlyphs; ++i)
-            bufArray[i] = static_cast<jfloat>(advances[i].width());
-        env->ReleaseFloatArrayElements(jAdvance, bufArray, 0);
-    }
-    static jmethodID refFloatArr_mID = env->GetMethodID(
-        PG_GetRenderQueueClass(env),
-        "refFloatArr",
-        "([F)I");
-    ASSERT(refFloatArr_mID);
-    jint aid = env->CallIntMethod(
-        rq.getWCRenderingQueue(),
-        refFloatArr_mID,
-        (jfloatArray)jAdvance);
-    WTF::CheckAndClearException(env);
+    // The glyphs and their advances are written into the queue right after
+    // the glyph count, see GraphicsDecoder.DRAWSTRING_FAST.
+    RenderingQueue& rq = context.platformContext()->rq().freeSpace(20 + numGlyphs * 8);
 
     rq << (jint)com_sun_webkit_graphics_GraphicsDecoder_DRAWSTRING_FAST
        << font.platformData().nativeFontData()
-       << sid
-       << aid
-       << static_cast<jfloat>(point.x())
+       << static_cast<jint>(numGlyphs);
+    for (auto glyph : glyphs)
+        rq << static_cast<jint>(glyph);
+    for (auto& advance : advances)
+        rq << static_cast<jfloat>(advance.width());
+    rq << static_cast<jfloat>(point.x())
        << static_cast<jfloat>(point.y());
 }
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -31,6 +31,7 @@
 #include "FontDescription.h"
 #include "FontPlatformData.h"
 #include "FontSelector.h"
+#include "GlyphPage.h"
 #include "GraphicsContextJava.h"
 #include "NotImplemented.h"
 
@@ -122,26 +123,51 @@ RefPtr<Font> Font::platformCreateScaledFont(const FontDescription&, float scaleF
     return Font::create(*m_platformData.derive(scaleFactor), origin(), IsInterstitial::No);
 }
 
+// Metrics are fetched from Java for a whole block of consecutive glyphs at a
+// time, and the ones not asked for go straight into the metrics maps of the
+// font. Bounds are costlier to compute than advances, hence the smaller block.
+static constexpr unsigned glyphWidthBlockSize = GlyphPage::size;
+static constexpr unsigned glyphBoundsBlockSize = 16;
+
 float Font::platformWidthForGlyph(Glyph c) const
 {
+#if USE(JAVA_FREETYPE)
+    if (auto* face = m_platformData.freeTypeFace())
+        return face->advance(c, m_platformData.size());
+#endif
+
     JNIEnv* env = WTF::GetJavaEnv();
 
     RefPtr<RQRef> jFont = m_platformData.nativeFontData();
     if (!jFont)
         return 0.0f;
 
-    static jmethodID getGlyphWidth_mID = env->GetMethodID(PG_GetFontClass(env),
-        "getGlyphWidth", "(I)D");
-    ASSERT(getGlyphWidth_mID);
+    static jmethodID getGlyphWidths_mID = env->GetMethodID(PG_GetFontClass(env),
+        "getGlyphWidths", "(ILjava/nio/ByteBuffer;)V");
+    ASSERT(getGlyphWidths_mID);
 
-    float res = env->CallDoubleMethod(*jFont, getGlyphWidth_mID, (jint)c);
-    WTF::CheckAndClearException(env);
+    Glyph firstGlyph = c - c % glyphWidthBlockSize;
+    std::array<jfloat, glyphWidthBlockSize> widths;
+    JLObject buffer(env->NewDirectByteBuffer(widths.data(), sizeof(widths)));
+    env->CallVoidMethod(*jFont, getGlyphWidths_mID, (jint)firstGlyph, (jobject)buffer);
+    if (WTF::CheckAndClearException(env))
+        return 0.0f;
 
-    return res;
+    for (unsigned i = 0; i < glyphWidthBlockSize; ++i) {
+        Glyph glyph = firstGlyph + i;
+        if (glyph != c)
+            m_glyphToWidthMap.setMetricsForGlyph(glyph, widths[i]);
+    }
+    return widths[c - firstGlyph];
 }
 
 FloatRect Font::platformBoundsForGlyph(Glyph c) const
 {
+#if USE(JAVA_FREETYPE)
+    if (auto* face = m_platformData.freeTypeFace())
+        return face->bounds(c, m_platformData.size());
+#endif
+
     JNIEnv* env = WTF::GetJavaEnv();
 
     RefPtr<RQRef> jFont = m_platformData.nativeFontData();
@@ -149,15 +175,26 @@ FloatRect Font::platformBoundsForGlyph(Glyph c) const
         return {};
     }
 
-    static jmethodID getGlyphBoundingBox_mID = env->GetMethodID(PG_GetFontClass(env), "getGlyphBoundingBox", "(I)[F");
-    ASSERT(getGlyphBoundingBox_mID);
+    static jmethodID getGlyphBoundingBoxes_mID = env->GetMethodID(PG_GetFontClass(env),
+        "getGlyphBoundingBoxes", "(ILjava/nio/ByteBuffer;)V");
+    ASSERT(getGlyphBoundingBoxes_mID);
 
-    jfloatArray boundingBox = (jfloatArray)env->CallObjectMethod(*jFont, getGlyphBoundingBox_mID, (jint)c);
-    jfloat *bBox = env->GetFloatArrayElements(boundingBox,0);
-    auto bb = FloatRect { bBox[0], bBox[1], bBox[2], bBox[3] };
-    env->ReleaseFloatArrayElements(boundingBox, bBox, 0);
-    WTF::CheckAndClearException(env);
-    return bb;
+    Glyph firstGlyph = c - c % glyphBoundsBlockSize;
+    std::array<std::array<jfloat, 4>, glyphBoundsBlockSize> boxes;
+    JLObject buffer(env->NewDirectByteBuffer(boxes.data(), sizeof(boxes)));
+    env->CallVoidMethod(*jFont, getGlyphBoundingBoxes_mID, (jint)firstGlyph, (jobject)buffer);
+    if (WTF::CheckAndClearException(env))
+        return {};
+
+    if (!m_glyphToBoundsMap)
+        m_glyphToBoundsMap = makeUnique<GlyphMetricsMap<FloatRect>>();
+    for (unsigned i = 0; i < glyphBoundsBlockSize; ++i) {
+        Glyph glyph = firstGlyph + i;
+        if (glyph != c)
+            m_glyphToBoundsMap->setMetricsForGlyph(glyph, FloatRect { boxes[i][0], boxes[i][1], boxes[i][2], boxes[i][3] });
+    }
+    auto& box = boxes[c - firstGlyph];
+    return FloatRect { box[0], box[1], box[2], box[3] };
 }
 
 Path Font::platformPathForGlyph(Glyph) const
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2020, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -57,10 +57,30 @@ RefPtr<RQRef> getJavaFont(const String& family, float size, bool italic, bool bo
 
     return RQRef::create(wcFont);
 }
+
+#if USE(JAVA_FREETYPE)
+RefPtr<FreeTypeFaceJava> getFreeTypeFace(RQRef& font)
+{
+    JNIEnv* env = WTF::GetJavaEnv();
+
+    static jmethodID mid = env->GetMethodID(PG_GetFontClass(env),
+        "getFontFile", "()Ljava/lang/String;");
+    ASSERT(mid);
+
+    JLString fontFile(static_cast<jstring>(env->CallObjectMethod(font, mid)));
+    if (WTF::CheckAndClearException(env) || !fontFile)
+        return nullptr;
+
+    return FreeTypeFaceJava::forFile(String(env, fontFile));
+}
+#endif
 }
 
 FontPlatformData::FontPlatformData(RefPtr<RQRef> font, float size)
     : m_jFont(font)
+#if USE(JAVA_FREETYPE)
+    , m_freeTypeFace(font ? getFreeTypeFace(*font) : nullptr)
+#endif
     , m_size(size)
 {
 }
@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "config.h"
+#include "FreeTypeFaceJava.h"
+
+#if USE(JAVA_FREETYPE)
+
+#include <ft2build.h>
+#include FT_FREETYPE_H
+#include FT_ADVANCES_H
+#include FT_OUTLINE_H
+
+#include <wtf/HashMap.h>
+#include <wtf/ListHashSet.h>
+#include <wtf/Lock.h>
+#include <wtf/NeverDestroyed.h>
+#include <wtf/text/CString.h>
+#include <wtf/text/StringHash.h>
+
+namespace WebCore {
+
+// Matches CharToGlyphMapper.INVISIBLE_GLYPH_ID, which always has no advance.
+static constexpr Glyph invisibleGlyph = 0xffff;
+
+// FT_Library and the faces created from it are not thread safe.
+static Lock freeTypeLock;
+
+static FT_Library freeTypeLibrary() WTF_REQUIRES_LOCK(freeTypeLock)
+{
+    static FT_Library library;
+    static bool initialized;
+    if (!initialized) {
+        initialized = true;
+        if (FT_Init_FreeType(&library))
+            library = nullptr;
+    }
+    return library;
+}
+
+// Each face keeps its font file open, so only the most recently used ones
+// are cached. Faces still used by fonts stay alive after being evicted.
+static constexpr unsigned maxCachedFaceCount = 64;
+
+static HashMap<String, RefPtr<FreeTypeFaceJava>>& faceCache() WTF_REQUIRES_LOCK(freeTypeLock)
+{
+    static NeverDestroyed<HashMap<String, RefPtr<FreeTypeFaceJava>>> cache;
+    return cache;
+}
+
+// Paths of the cached faces, least recently used first.
+static ListHashSet<String>& faceCacheUsage() WTF_REQUIRES_LOCK(freeTypeLock)
+{
+    static NeverDestroyed<ListHashSet<String>> usage;
+    return usage;
+}
+
+RefPtr<FreeTypeFaceJava> FreeTypeFaceJava::forFile(const String& path)
+{
+    if (path.isEmpty())
+        return nullptr;
+
+    // Destroying a face takes the lock, so an evicted face is only released
+    // once the lock is no longer held.
+    RefPtr<FreeTypeFaceJava> evictedFace;
+    Locker locker { freeTypeLock };
+    auto& cache = faceCache();
+    auto& usage = faceCacheUsage();
+    usage.appendOrMoveToLast(path);
+
+    // Failures are cached as well, so a bad file is only tried once.
+    auto result = cache.ensure(path, [&]() -> RefPtr<FreeTypeFaceJava> {
+        FT_Library library = freeTypeLibrary();
+        if (!library)
+            return nullptr;
+
+        FT_Face face;
+        if (FT_New_Face(library, path.utf8().data(), 0, &face))
+            return nullptr;
+        if (!FT_IS_SCALABLE(face) || !face->units_per_EM) {
+            FT_Done_Face(face);
+            return nullptr;
+        }
+        return adoptRef(new FreeTypeFaceJava(face));
+    });
+    RefPtr<FreeTypeFaceJava> face = result.iterator->value;
+
+    if (result.isNewEntry && cache.size() > maxCachedFaceCount)
+        evictedFace = cache.take(usage.takeFirst());
+    return face;
+}
+
+FreeTypeFaceJava::~FreeTypeFaceJava()
+{
+    Locker locker { freeTypeLock };
+    FT_Done_Face(m_face);
+}
+
+float FreeTypeFaceJava::advance(Glyph glyph, float size) const
+{
+    if (glyph == invisibleGlyph)
+        return 0;
+
+    Locker locker { freeTypeLock };
+    FT_Fixed advance;
+    if (FT_Get_Advance(m_face, glyph, FT_LOAD_NO_SCALE, &advance))
+        return 0;
+    return advance * size / m_face->units_per_EM;
+}
+
+FloatRect FreeTypeFaceJava::bounds(Glyph glyph, float size) const
+{
+    Locker locker { freeTypeLock };
+    if (glyph >= m_face->num_glyphs
+        || FT_Load_Glyph(m_face, glyph, FT_LOAD_NO_SCALE | FT_LOAD_NO_HINTING | FT_LOAD_NO_BITMAP)
+        || m_face->glyph->format != FT_GLYPH_FORMAT_OUTLINE)
+        return { };
+
+    FT_BBox box;
+    FT_Outline_Get_CBox(&m_face->glyph->outline, &box);
+    float scale = size / m_face->units_per_EM;
+    // Same layout as WCFont.getGlyphBoundingBoxes().
+    return FloatRect(box.xMin * scale, -box.yMax * scale, box.xMax * scale, (box.yMax - box.yMin) * scale);
+}
+
+} // namespace WebCore
+
+#endif // USE(JAVA_FREETYPE)
@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#pragma once
+
+#if USE(JAVA_FREETYPE)
+
+#include "FloatRect.h"
+#include "Glyph.h"
+#include <wtf/ThreadSafeRefCounted.h>
+#include <wtf/text/WTFString.h>
+
+typedef struct FT_FaceRec_* FT_Face;
+
+namespace WebCore {
+
+// A FreeType face opened on the font file behind a WCFont. Glyph metrics are
+// read from it directly, matching what the prism font code reports for the
+// same file, so that measuring text does not have to call into Java.
+class FreeTypeFaceJava : public ThreadSafeRefCounted<FreeTypeFaceJava> {
+public:
+    // Faces are shared by all the fonts using the same file. Returns nullptr
+    // if the file cannot be opened or has no scalable outlines.
+    static RefPtr<FreeTypeFaceJava> forFile(const String& path);
+    ~FreeTypeFaceJava();
+
+    float advance(Glyph, float size) const;
+    FloatRect bounds(Glyph, float size) const;
+
+private:
+    explicit FreeTypeFaceJava(FT_Face face)
+        : m_face(face)
+    {}
+
+    FT_Face m_face;
+};
+
+} // namespace WebCore
+
+#endif // USE(JAVA_FREETYPE)
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -48,6 +48,7 @@
 #include "Logging.h"
 #include "NotImplemented.h"
 #include "Path.h"
+#include "PathJava.h"
 #include "Pattern.h"
 #include "PlatformContextJava.h"
 #include "RenderingQueue.h"
@@ -93,6 +94,12 @@ static void setGradient(Gradient &gradient,
     p0 = gradientSpaceTransformation.mapPoint(p0);
     p1 = gradientSpaceTransformation.mapPoint(p1);
 
+    // The gradient replaces the solid color on the Java side.
+    if (id == com_sun_webkit_graphics_GraphicsDecoder_SET_FILL_GRADIENT)
+        context->invalidateState(&PlatformStateShadow::fillColor);
+    else
+        context->invalidateState(&PlatformStateShadow::strokeColor);
+
     context->rq().freeSpace(4 * 11 + 20 * nStops)
     << id
     << (jfloat)p0.x()
@@ -118,6 +125,24 @@ static void setGradient(Gradient &gradient,
     }
 }
 
+// Colors that fit into 8-bit sRGBA are sent to Java packed into a single
+// ARGB jint (see GraphicsDecoder.getPackedColor) instead of four floats,
+// unless an older encoding version has been asked for.
+static std::optional<jint> packedColor(const Color& color)
+{
+    if (RenderingQueue::encodingVersion() < com_sun_webkit_graphics_GraphicsDecoder_ENCODING_VERSION_PACKED_COLORS)
+        return std::nullopt;
+
+    auto bytes = color.tryGetAsSRGBABytes();
+    if (!bytes)
+        return std::nullopt;
+
+    return static_cast<jint>((static_cast<uint32_t>(bytes->alpha) << 24)
+        | (static_cast<uint32_t>(bytes->red) << 16)
+        | (static_cast<uint32_t>(bytes->green) << 8)
+        | static_cast<uint32_t>(bytes->blue));
+}
+
 static void flushImageRQ(PlatformGraphicsContext* context, const PlatformImagePtr& image)
 {
     if (!image || !image->getRenderingQueue())
@@ -161,8 +186,7 @@ void GraphicsContextJava::savePlatformState()
     if (paintingDisabled())
         return;
 
-    platformContext()->rq().freeSpace(4)
-    << (jint)com_sun_webkit_graphics_GraphicsDecoder_SAVESTATE;
+    platformContext()->saveState();
 }
 
 void GraphicsContextJava::restore(GraphicsContextState::Purpose) {
@@ -172,7 +196,7 @@ void GraphicsContextJava::restore(GraphicsContextState::Purpose) {
 
 void GraphicsContextJava::restorePlatformState()
 {
-    if (paintingDisabled())
+    if (paintingDisabled() || !platformContext()->restoreState())
         return;
 
     platformContext()->rq().freeSpace(4)
@@ -230,6 +254,15 @@ void GraphicsContextJava::fillRect(const FloatRect& rect, const Color& color)
     if (paintingDisabled())
         return;
 
+    if (auto packed = packedColor(color)) {
+        platformContext()->rq().freeSpace(24)
+        << (jint)com_sun_webkit_graphics_GraphicsDecoder_FILLRECT_FFFFP
+        << rect.x() << rect.y()
+        << rect.width() << rect.height()
+        << *packed;
+        return;
+    }
+
     auto [r, g, b, a] = color.toColorTypeLossy<SRGBA<float>>().resolved();
     platformContext()->rq().freeSpace(36)
     << (jint)com_sun_webkit_graphics_GraphicsDecoder_FILLRECT_FFFFI
@@ -284,6 +317,10 @@ void GraphicsContextJava::clip(const FloatRect& rect)
         return;
 
     m_state.clipBounds.intersect(m_state.transform.mapRect(rect));
+    // Clipping to the same rect again under the same transform is a no-op.
+    if (!platformContext()->updateState(&PlatformStateShadow::clipRect, rect))
+        return;
+
     platformContext()->rq().freeSpace(20)
     << (jint)com_sun_webkit_graphics_GraphicsDecoder_SETCLIP_IIII
     << (jint)rect.x() << (jint)rect.y() << (jint)rect.width() << (jint)rect.height();
@@ -491,9 +528,10 @@ void GraphicsContextJava::drawDotsForDocumentMarker(const FloatRect& rect, Docum
 
 void GraphicsContextJava::translate(float x, float y)
 {
-    if (paintingDisabled())
+    if (paintingDisabled() || (!x && !y))
         return;
 
+    platformContext()->invalidateState(&PlatformStateShadow::clipRect);
     m_state.transform.translate(x, y);
     platformContext()->rq().freeSpace(12)
     << (jint)com_sun_webkit_graphics_GraphicsDecoder_TRANSLATE
@@ -502,8 +540,15 @@ void GraphicsContextJava::translate(float x, float y)
 
 void GraphicsContextJava::setPlatformFillColor(const Color& color)
 {
-    if (paintingDisabled())
+    if (paintingDisabled() || !platformContext()->updateState(&PlatformStateShadow::fillColor, color))
+        return;
+
+    if (auto packed = packedColor(color)) {
+        platformContext()->rq().freeSpace(8)
+        << (jint)com_sun_webkit_graphics_GraphicsDecoder_SETFILLCOLOR_PACKED
+        << *packed;
         return;
+    }
 
     auto [r, g, b, a] = color.toColorTypeLossy<SRGBA<float>>().resolved();
     platformContext()->rq().freeSpace(20)
@@ -537,8 +582,15 @@ void GraphicsContextJava::setPlatformStrokeStyle(StrokeStyle style)
 
 void GraphicsContextJava::setPlatformStrokeColor(const Color& color)
 {
-    if (paintingDisabled())
+    if (paintingDisabled() || !platformContext()->updateState(&PlatformStateShadow::strokeColor, color))
+        return;
+
+    if (auto packed = packedColor(color)) {
+        platformContext()->rq().freeSpace(8)
+        << (jint)com_sun_webkit_graphics_GraphicsDecoder_SETSTROKECOLOR_PACKED
+        << *packed;
         return;
+    }
 
     auto [r, g, b, a] = color.toColorTypeLossy<SRGBA<float>>().resolved();
     platformContext()->rq().freeSpace(20)
@@ -548,7 +600,7 @@ void GraphicsContextJava::setPlatformStrokeColor(const Color& color)
 
 void GraphicsContextJava::setPlatformStrokeThickness(float strokeThickness)
 {
-    if (paintingDisabled())
+    if (paintingDisabled() || !platformContext()->updateState(&PlatformStateShadow::strokeThickness, strokeThickness))
         return;
 
     platformContext()->rq().freeSpace(8)
@@ -573,9 +625,10 @@ void GraphicsContextJava::setURLForRect(const URL&, const FloatRect&)
 
 void GraphicsContextJava::concatCTM(const AffineTransform& at)
 {
-    if (paintingDisabled())
+    if (paintingDisabled() || at.isIdentity())
         return;
 
+    platformContext()->invalidateState(&PlatformStateShadow::clipRect);
     m_state.transform.multiply(at);
     platformContext()->rq().freeSpace(28)
     << (jint)com_sun_webkit_graphics_GraphicsDecoder_CONCATTRANSFORM_FFFFFF
@@ -623,6 +676,7 @@ void GraphicsContextJava::beginTransparencyLayer(float opacity)
     if (paintingDisabled())
       return;
 
+    platformContext()->beginLayer();
     platformContext()->rq().freeSpace(8)
     << (jint)com_sun_webkit_graphics_GraphicsDecoder_BEGINTRANSPARENCYLAYER
     << opacity;
@@ -635,6 +689,7 @@ void GraphicsContextJava::endTransparencyLayer()
 
     platformContext()->rq().freeSpace(4)
     << (jint)com_sun_webkit_graphics_GraphicsDecoder_ENDTRANSPARENCYLAYER;
+    platformContext()->endLayer();
 
     GraphicsContext::endTransparencyLayer();
 }
@@ -727,6 +782,9 @@ void GraphicsContextJava::setMiterLimit(float limit)
 
 void GraphicsContextJava::setPlatformAlpha(float alpha)
 {
+    if (!platformContext()->updateState(&PlatformStateShadow::alpha, alpha))
+        return;
+
     platformContext()->rq().freeSpace(8)
     << (jint)com_sun_webkit_graphics_GraphicsDecoder_SETALPHA
     << alpha;
@@ -734,7 +792,7 @@ void GraphicsContextJava::setPlatformAlpha(float alpha)
 
 void GraphicsContextJava::setPlatformCompositeOperation(CompositeOperator op, BlendMode)
 {
-    if (paintingDisabled())
+    if (paintingDisabled() || !platformContext()->updateState(&PlatformStateShadow::compositeOperator, op))
         return;
 
     platformContext()->rq().freeSpace(8)
@@ -756,10 +814,11 @@ void GraphicsContextJava::strokePath(const Path& path)
             com_sun_webkit_graphics_GraphicsDecoder_SET_STROKE_GRADIENT);
     }
 
-    platformContext()->rq().freeSpace(12)
-    << (jint)com_sun_webkit_graphics_GraphicsDecoder_STROKE_PATH
-    << copyPath(path.platformPath())
+    const PathJava& segments = path.platformPathImpl();
+    RenderingQueue& rq = platformContext()->rq().freeSpace(8 + segments.serializedSize())
+    << (jint)com_sun_webkit_graphics_GraphicsDecoder_STROKE_PATH_SEGMENTS
     << (jint)fillRule();
+    segments.serializeSegments(rq);
 }
 
 static void setClipPath(
@@ -773,13 +832,17 @@ static void setClipPath(
         return;
 
     state.clipBounds.intersect(state.transform.mapRect(path.fastBoundingRect()));
-    gc.platformContext()->rq().freeSpace(16)
-    << jint(com_sun_webkit_graphics_GraphicsDecoder_CLIP_PATH)
-    << copyPath(path.platformPath())
+    // The Java side clips to a path in a new layer, which stays in effect
+    // until the enclosing RESTORESTATE.
+    gc.platformContext()->resetState();
+    const PathJava& segments = path.platformPathImpl();
+    RenderingQueue& rq = gc.platformContext()->rq().freeSpace(12 + segments.serializedSize())
+    << jint(com_sun_webkit_graphics_GraphicsDecoder_CLIP_PATH_SEGMENTS)
     << jint(wrule == WindRule::EvenOdd
        ? com_sun_webkit_graphics_WCPath_RULE_EVENODD
-       : com_sun_webkit_graphics_WCPath_RULE_NONZERO)
-    << jint(isOut);
+       : com_sun_webkit_graphics_WCPath_RULE_NONZERO);
+    segments.serializeSegments(rq);
+    rq << jint(isOut);
 }
 
 void GraphicsContextJava::canvasClip(const Path& path, WindRule fillRule)
@@ -899,18 +962,20 @@ void GraphicsContextJava::fillPath(const Path& path)
                 com_sun_webkit_graphics_GraphicsDecoder_SET_FILL_GRADIENT);
         }
 
-        platformContext()->rq().freeSpace(12)
-        << (jint)com_sun_webkit_graphics_GraphicsDecoder_FILL_PATH
-        << copyPath(path.platformPath())
+        const PathJava& segments = path.platformPathImpl();
+        RenderingQueue& rq = platformContext()->rq().freeSpace(8 + segments.serializedSize())
+        << (jint)com_sun_webkit_graphics_GraphicsDecoder_FILL_PATH_SEGMENTS
         << (jint)fillRule();
+        segments.serializeSegments(rq);
     }
 }
 
 void GraphicsContextJava::rotate(float radians)
 {
-    if (paintingDisabled())
+    if (paintingDisabled() || !radians)
         return;
 
+    platformContext()->invalidateState(&PlatformStateShadow::clipRect);
     m_state.transform.rotate(radians);
     platformContext()->rq().freeSpace(2 * 4)
     << (jint)com_sun_webkit_graphics_GraphicsDecoder_ROTATE
@@ -920,9 +985,10 @@ void GraphicsContextJava::rotate(float radians)
 
 void GraphicsContextJava::scale(const FloatSize& size)
 {
-    if (paintingDisabled())
+    if (paintingDisabled() || (size.width() == 1 && size.height() == 1))
         return;
 
+    platformContext()->invalidateState(&PlatformStateShadow::clipRect);
     m_state.transform.scale(size.width(), size.height());
     platformContext()->rq().freeSpace(12)
     << (jint)com_sun_webkit_graphics_GraphicsDecoder_SCALE
@@ -1070,6 +1136,7 @@ void GraphicsContextJava::setCTM(const AffineTransform& tm)
     if (paintingDisabled())
         return;
 
+    platformContext()->invalidateState(&PlatformStateShadow::clipRect);
     m_state.transform = tm;
     platformContext()->rq().freeSpace(28)
     << (jint)com_sun_webkit_graphics_GraphicsDecoder_SET_TRANSFORM
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2020, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -36,6 +36,8 @@
 #include "GraphicsContextJava.h"
 namespace WebCore {
 
+static constexpr size_t pixelAlignment = 64;
+
 std::unique_ptr<ImageBufferJavaBackend> ImageBufferJavaBackend::create(
     const Parameters& parameters, const ImageBufferCreationContext&)
 {
@@ -51,11 +53,13 @@ std::unique_ptr<ImageBufferJavaBackend> ImageBufferJavaBackend::create(
         "(II)Lcom/sun/webkit/graphics/WCImage;");
     ASSERT(midCreateImage);
 
+    jint width = ceilf(parameters.resolutionScale * parameters.backendSize.width());
+    jint height = ceilf(parameters.resolutionScale * parameters.backendSize.height());
     jobject imageObj = env->CallObjectMethod(
         PL_GetGraphicsManager(env),
         midCreateImage,
-        (jint) ceilf(parameters.resolutionScale * parameters.backendSize.width()),
-        (jint) ceilf(parameters.resolutionScale * parameters.backendSize.height())
+        width,
+        height
     );
 
     if (WTF::CheckAndClearException(env) || !imageObj) {
@@ -64,6 +68,26 @@ std::unique_ptr<ImageBufferJavaBackend> ImageBufferJavaBackend::create(
 
     auto image = RQRef::create(JLObject(imageObj));
 
+    // A fresh image is transparent black, and so are the pixels.
+    CheckedSize pixelsSize = CheckedSize(width) * height * 4;
+    if (pixelsSize.hasOverflowed())
+        return nullptr;
+    auto pixels = MallocSpan<uint8_t, FastAlignedMalloc>::tryAlignedMalloc(pixelAlignment, pixelsSize);
+    if (!pixels)
+        return nullptr;
+    zeroSpan(pixels.mutableSpan());
+
+    static jmethodID midSetPixelBuffer = env->GetMethodID(
+        PG_GetImageClass(env),
+        "setPixelBuffer",
+        "(Ljava/nio/ByteBuffer;)V");
+    ASSERT(midSetPixelBuffer);
+
+    JLObject pixelBuffer(env->NewDirectByteBuffer(pixels.mutableSpan().data(), pixels.span().size()));
+    env->CallVoidMethod(image->cloneLocalCopy(), midSetPixelBuffer, (jobject)pixelBuffer);
+    if (WTF::CheckAndClearException(env))
+        return nullptr;
+
     static jmethodID midCreateBufferedContextRQ = env->GetMethodID(
         PG_GetGraphicsManagerClass(env),
         "createBufferedContextRQ",
@@ -85,7 +109,7 @@ std::unique_ptr<ImageBufferJavaBackend> ImageBufferJavaBackend::create(
         backendSize.width(), backendSize.height());
 
     return std::unique_ptr<ImageBufferJavaBackend>(new ImageBufferJavaBackend(
-        parameters, WTF::move(platformImage), WTF::move(context), backendSize));
+        parameters, WTF::move(platformImage), WTF::move(context), backendSize, WTF::move(pixels)));
 }
 
 /*std::unique_ptr<ImageBufferJavaBackend> ImageBufferJavaBackend::create(
@@ -95,14 +119,40 @@ std::unique_ptr<ImageBufferJavaBackend> ImageBufferJavaBackend::create(
 }*/
 
 ImageBufferJavaBackend::ImageBufferJavaBackend(
-    const Parameters& parameters, PlatformImagePtr image, std::unique_ptr<GraphicsContext>&& context, IntSize backendSize)
+    const Parameters& parameters, PlatformImagePtr image, std::unique_ptr<GraphicsContext>&& context, IntSize backendSize, MallocSpan<uint8_t, FastAlignedMalloc>&& pixels)
     : ImageBufferBackend(parameters)
     , m_image(WTF::move(image))
     , m_context(WTF::move(context))
     , m_backendSize(backendSize)
+    , m_pixels(WTF::move(pixels))
+    , m_pixelsFlushedBufferCount(m_context->platformContext()->queue().flushedBufferCount())
 {
 }
 
+ImageBufferJavaBackend::~ImageBufferJavaBackend()
+{
+    // The Java image may outlive the backend (see copyNativeImage()) and may
+    // still have uploads from the pixels pending, so Java frees them once it
+    // is done with them (see WCImage.releasePixelBuffer()). If it cannot be
+    // told, the pixels are leaked rather than freed under a live view.
+    auto pixels = m_pixels.leakSpan();
+    JNIEnv* env = WTF::GetJavaEnv();
+    if (!env)
+        return;
+
+    static jmethodID midReleasePixelBuffer = env->GetMethodID(
+        PG_GetImageClass(env),
+        "releasePixelBuffer",
+        "(Ljava/nio/ByteBuffer;)V");
+    ASSERT(midReleasePixelBuffer);
+
+    JLObject pixelBuffer(env->NewDirectByteBuffer(pixels.data(), pixels.size()));
+    if (WTF::CheckAndClearException(env) || !pixelBuffer)
+        return;
+    env->CallVoidMethod(getWCImage(), midReleasePixelBuffer, (jobject)pixelBuffer);
+    WTF::CheckAndClearException(env);
+}
+
 JLObject ImageBufferJavaBackend::getWCImage() const
 {
     return m_image->getImage()->cloneLocalCopy();
@@ -113,7 +163,7 @@ Vector<uint8_t> ImageBufferJavaBackend::toDataJava(const String& mimeType, std::
     if (MIMETypeRegistry::isSupportedImageMIMETypeForEncoding(mimeType)) {
         // RenderQueue need to be processed before pixel buffer extraction.
         // For that purpose it has to be in actual state.
-        context().platformContext()->rq().flushBuffer();
+        context().platformContext()->queue().flushBuffer();
 
         JNIEnv* env = WTF::GetJavaEnv();
 
@@ -142,11 +192,14 @@ Vector<uint8_t> ImageBufferJavaBackend::toDataJava(const String& mimeType, std::
 
 std::pair<void*, size_t> ImageBufferJavaBackend::getDataAndSize()
 {
-    JNIEnv* env = WTF::GetJavaEnv();
-
     //RenderQueue need to be processed before pixel buffer extraction.
     //For that purpose it has to be in actual state.
-    context().platformContext()->rq().flushBuffer();
+    auto& rq = context().platformContext()->queue();
+    rq.flushBuffer();
+    if (rq.flushedBufferCount() == m_pixelsFlushedBufferCount)
+        return { m_pixels.mutableSpan().data(), m_pixels.span().size() };
+
+    JNIEnv* env = WTF::GetJavaEnv();
 
     static jmethodID midGetBGRABytes = env->GetMethodID(
         PG_GetImageClass(env),
@@ -154,30 +207,33 @@ std::pair<void*, size_t> ImageBufferJavaBackend::getDataAndSize()
         "()Ljava/nio/ByteBuffer;");
     ASSERT(midGetBGRABytes);
 
-    jobject pixelBuf = env->CallObjectMethod(getWCImage(), midGetBGRABytes);
+    // Reads the image back into m_pixels.
+    JLObject pixelBuf(env->CallObjectMethod(getWCImage(), midGetBGRABytes));
     if (WTF::CheckAndClearException(env) || !pixelBuf) {
         return {nullptr, 0};
     }
-    JLObject byteBuffer(pixelBuf);
+    ASSERT(env->GetDirectBufferAddress(pixelBuf) == m_pixels.span().data());
 
-    void* data = env->GetDirectBufferAddress(byteBuffer);
-    jlong capacity = env->GetDirectBufferCapacity(byteBuffer);
-    if (!data || capacity <= 0)
-        return {nullptr, 0};
-    return {data, static_cast<size_t>(capacity)};
+    m_pixelsFlushedBufferCount = rq.flushedBufferCount();
+    return { m_pixels.mutableSpan().data(), m_pixels.span().size() };
 }
 
-void ImageBufferJavaBackend::update() const
+void ImageBufferJavaBackend::update(const IntRect& rect) const
 {
+    IntRect dirtyRect = intersection(rect, IntRect({ }, m_backendSize));
+    if (dirtyRect.isEmpty())
+        return;
+
     JNIEnv* env = WTF::GetJavaEnv();
 
     static jmethodID midUpdateByteBuffer = env->GetMethodID(
         PG_GetImageClass(env),
         "drawPixelBuffer",
-        "()V");
+        "(IIII)V");
     ASSERT(midUpdateByteBuffer);
 
-    env->CallObjectMethod(getWCImage(), midUpdateByteBuffer);
+    env->CallVoidMethod(getWCImage(), midUpdateByteBuffer,
+        dirtyRect.x(), dirtyRect.y(), dirtyRect.width(), dirtyRect.height());
     WTF::CheckAndClearException(env);
 }
 
@@ -219,7 +275,6 @@ void ImageBufferJavaBackend::getPixelBuffer(const IntRect& srcRect, std::span<co
 void ImageBufferJavaBackend::putPixelBuffer(const PixelBufferSourceView& sourcePixelBuffer, const IntRect& srcRect, const IntPoint& destPoint, AlphaPremultiplication destFormat, std::span<uint8_t> destination)
 {
     ImageBufferBackend::putPixelBuffer(sourcePixelBuffer, srcRect, destPoint, destFormat, destination);
-    update();
 }
 
 void ImageBufferJavaBackend::putPixelBuffer(const PixelBufferSourceView& sourcePixelBuffer, const IntRect& srcRect, const IntPoint& destPoint, AlphaPremultiplication destFormat) //override
@@ -229,7 +284,9 @@ void ImageBufferJavaBackend::putPixelBuffer(const PixelBufferSourceView& sourceP
         return;
     std::span<uint8_t> spanData(static_cast<uint8_t*>(data), size);
     putPixelBuffer(sourcePixelBuffer, srcRect, destPoint, destFormat, spanData);
-    update();
+    IntRect dirtyRect = srcRect;
+    dirtyRect.moveBy(destPoint);
+    update(dirtyRect);
 }
 
 size_t ImageBufferJavaBackend::calculateMemoryCost(const Parameters& parameters)
@@ -263,3 +320,14 @@ bool ImageBufferJavaBackend::canMapBackingStore() const
 }
 
 } // namespace WebCore
+
+using namespace WebCore;
+extern "C" {
+
+JNIEXPORT void JNICALL Java_com_sun_webkit_graphics_WCImage_twkFreePixelBuffer
+    (JNIEnv* env, jclass, jobject pixelBuffer)
+{
+    fastAlignedFree(env->GetDirectBufferAddress(pixelBuffer));
+}
+
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2020, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -30,12 +30,13 @@
 
 #include "PlatformImage.h"
 #include "RQRef.h"
+#include <wtf/MallocSpan.h>
 
 namespace WebCore {
 
 class ImageBufferJavaBackend : public ImageBufferBackend {
 public:
-    ~ImageBufferJavaBackend() {}
+    ~ImageBufferJavaBackend();
     static unsigned calculateBytesPerRow(const IntSize& backendSize);
     static size_t calculateMemoryCost(const Parameters&);
     void transformToColorSpace(const DestinationColorSpace&) override { }
@@ -45,8 +46,10 @@ public:
 
     JLObject getWCImage() const;
     Vector<uint8_t> toDataJava(const String& mimeType, std::optional<double>) override;
+    // The BGRA8 pixels of the image, brought up to date with what has been
+    // drawn into it. After changing them, call update() with the changed part.
     std::pair<void*, size_t> getDataAndSize();
-    void update() const;
+    void update(const IntRect&) const;
 
     GraphicsContext& context() override;
     void flushContext() override;
@@ -65,7 +68,7 @@ public:
     bool canMapBackingStore() const final;
 
 protected:
-    ImageBufferJavaBackend(const Parameters&, PlatformImagePtr, std::unique_ptr<GraphicsContext>&&, IntSize);
+    ImageBufferJavaBackend(const Parameters&, PlatformImagePtr, std::unique_ptr<GraphicsContext>&&, IntSize, MallocSpan<uint8_t, FastAlignedMalloc>&&);
 
     void getPixelBuffer(const IntRect& srcRect, std::span<const uint8_t> data, PixelBuffer& destination);
     void putPixelBuffer(const PixelBufferSourceView&, const IntRect& srcRect, const IntPoint& destPoint, AlphaPremultiplication destFormat, std::span<uint8_t> destination);
@@ -76,6 +79,12 @@ protected:
     PlatformImagePtr m_image;
     std::unique_ptr<GraphicsContext> m_context;
     IntSize m_backendSize;
+
+    // Pixel storage shared with the Java image as a direct ByteBuffer. It is
+    // only read back from Java when drawing commands have been flushed since
+    // the last time.
+    MallocSpan<uint8_t, FastAlignedMalloc> m_pixels;
+    unsigned m_pixelsFlushedBufferCount { 0 };
 };
 
 } // namespace WebCore
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2017, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -33,6 +33,11 @@
 #include "PlatformJavaClasses.h"
 #include "Logging.h"
 
+#include <wtf/MainThread.h>
+#include <wtf/NeverDestroyed.h>
+#include <wtf/NumberOfCores.h>
+#include <wtf/WTFSemaphore.h>
+
 namespace WebCore {
 
 WTF_MAKE_TZONE_ALLOCATED_IMPL(ImageDecoderJava);
@@ -95,6 +100,8 @@ ImageDecoderJava::~ImageDecoderJava()
             "()V");
     ASSERT(midDestroy);
 
+    // Once destroy() returns, the Java decoder no longer reads from the
+    // data views, which are released with the members.
     env->CallVoidMethod(m_nativeDecoder, midDestroy);
     WTF::CheckAndClearException(env);
 }
@@ -109,17 +116,18 @@ void ImageDecoderJava::setData(const FragmentedSharedBuffer& data, bool allDataR
     static jmethodID midAddImageData = env->GetMethodID(
         PG_GetGraphicsImageDecoderClass(env),
         "addImageData",
-        "([B)V");
+        "(Ljava/nio/ByteBuffer;)V");
     ASSERT(midAddImageData);
 
     while (m_receivedDataSize < data.size()) {
-        const auto& someData = data.getSomeData(m_receivedDataSize);
+        auto someData = data.getSomeData(m_receivedDataSize);
         unsigned length = someData.size();
-        JLByteArray jArray(env->NewByteArray(length));
-        if (jArray && !WTF::CheckAndClearException(env)) {
-            // not OOME in Java
-            env->SetByteArrayRegion(jArray, 0, length, (const jbyte*)someData.span().data());
-            env->CallVoidMethod(m_nativeDecoder, midAddImageData, (jbyteArray)jArray);
+        // The decoder reads from a direct view of the segment, which is
+        // kept alive until the decoder is destroyed.
+        JLObject jBuffer(env->NewDirectByteBuffer(const_cast<uint8_t*>(someData.span().data()), length));
+        if (jBuffer && !WTF::CheckAndClearException(env)) {
+            m_dataViews.append(WTFMove(someData));
+            env->CallVoidMethod(m_nativeDecoder, midAddImageData, (jobject)jBuffer);
             WTF::CheckAndClearException(env);
         }
         m_receivedDataSize += length;
@@ -178,23 +186,68 @@ size_t ImageDecoderJava::frameCount() const
         : count;
 }
 
-PlatformImagePtr ImageDecoderJava::createFrameImageAtIndex(size_t idx, SubsamplingLevel, const DecodingOptions&)
+// Every BitmapImageSource decoding asynchronously gets its own work queue,
+// so a page full of large images would otherwise decode all of them at once
+// and starve the main thread. Visible images are decoded synchronously on the
+// main thread and do not go through this gate.
+static Semaphore& asyncDecodingSlots()
+{
+    static NeverDestroyed<Semaphore> slots(std::clamp(WTF::numberOfProcessorCores() / 2, 1, 4));
+    return slots;
+}
+
+class AsyncDecodingSlot {
+public:
+    AsyncDecodingSlot() { asyncDecodingSlots().wait(); }
+    ~AsyncDecodingSlot() { asyncDecodingSlots().signal(); }
+};
+
+static IntSize subsampledSize(const IntSize& size, SubsamplingLevel subsamplingLevel)
+{
+    int shift = static_cast<int>(subsamplingLevel);
+    int round = (1 << shift) - 1;
+    return { (size.width() + round) >> shift, (size.height() + round) >> shift };
+}
+
+PlatformImagePtr ImageDecoderJava::createFrameImageAtIndex(size_t idx, SubsamplingLevel subsamplingLevel, const DecodingOptions&)
 {
     JNIEnv* env = WTF::GetJavaEnv();
     if (!env || !m_nativeDecoder) {
         return { };
     }
 
-    static jmethodID midGetFrame = env->GetMethodID(
-        PG_GetGraphicsImageDecoderClass(env),
-        "getFrame",
-        "(I)Lcom/sun/webkit/graphics/WCImageFrame;");
-    ASSERT(midGetFrame);
+    std::optional<AsyncDecodingSlot> slot;
+    if (!isMainThread())
+        slot.emplace();
 
-    JLObject frame(env->CallObjectMethod(
-        m_nativeDecoder,
-        midGetFrame,
-        idx));
+    jobject jframe;
+    if (subsamplingLevel == SubsamplingLevel::Default || m_size.isEmpty()) {
+        static jmethodID midGetFrame = env->GetMethodID(
+            PG_GetGraphicsImageDecoderClass(env),
+            "getFrame",
+            "(I)Lcom/sun/webkit/graphics/WCImageFrame;");
+        ASSERT(midGetFrame);
+
+        jframe = env->CallObjectMethod(
+            m_nativeDecoder,
+            midGetFrame,
+            idx);
+    } else {
+        static jmethodID midGetScaledFrame = env->GetMethodID(
+            PG_GetGraphicsImageDecoderClass(env),
+            "getScaledFrame",
+            "(III)Lcom/sun/webkit/graphics/WCImageFrame;");
+        ASSERT(midGetScaledFrame);
+
+        auto scaledSize = subsampledSize(m_size, subsamplingLevel);
+        jframe = env->CallObjectMethod(
+            m_nativeDecoder,
+            midGetScaledFrame,
+            idx,
+            scaledSize.width(),
+            scaledSize.height());
+    }
+    JLObject frame(jframe);
     WTF::CheckAndClearException(env);
 
     if(!frame)
@@ -261,21 +314,42 @@ IntSize ImageDecoderJava::size() const
     return m_size;
 }
 
-IntSize ImageDecoderJava::frameSizeAtIndex(size_t idx, SubsamplingLevel) const
+IntSize ImageDecoderJava::frameSizeAtIndex(size_t idx, SubsamplingLevel subsamplingLevel) const
 {
     JNIEnv* env = WTF::GetJavaEnv();
     if (!env || !m_nativeDecoder) {
         return { };
     }
-    static jmethodID midGetFrameSize = env->GetMethodID(
-        PG_GetGraphicsImageDecoderClass(env),
-        "getFrameSize",
-        "(I)[I");
-    ASSERT(midGetFrameSize);
-    JLocalRef<jintArray> jsize((jintArray)env->CallObjectMethod(
-                        m_nativeDecoder,
-                        midGetFrameSize,
-                        idx));
+
+    jobject jframeSize;
+    if (subsamplingLevel == SubsamplingLevel::Default || m_size.isEmpty()) {
+        static jmethodID midGetFrameSize = env->GetMethodID(
+            PG_GetGraphicsImageDecoderClass(env),
+            "getFrameSize",
+            "(I)[I");
+        ASSERT(midGetFrameSize);
+        jframeSize = env->CallObjectMethod(
+            m_nativeDecoder,
+            midGetFrameSize,
+            idx);
+    } else {
+        // The frame may still be decoded at full size (see getScaledFrame).
+        static jmethodID midGetScaledFrameSize = env->GetMethodID(
+            PG_GetGraphicsImageDecoderClass(env),
+            "getScaledFrameSize",
+            "(III)[I");
+        ASSERT(midGetScaledFrameSize);
+
+        auto scaledSize = subsampledSize(m_size, subsamplingLevel);
+        jframeSize = env->CallObjectMethod(
+            m_nativeDecoder,
+            midGetScaledFrameSize,
+            idx,
+            scaledSize.width(),
+            scaledSize.height());
+    }
+    JLocalRef<jintArray> jsize((jintArray)jframeSize);
+    WTF::CheckAndClearException(env);
     if (!jsize) {
         return m_size;
     }
@@ -289,7 +363,8 @@ IntSize ImageDecoderJava::frameSizeAtIndex(size_t idx, SubsamplingLevel) const
 
 bool ImageDecoderJava::frameAllowSubsamplingAtIndex(size_t) const
 {
-    notImplemented();
+    // WCImageDecoder.getScaledFrame() falls back to the full size frame
+    // where scaling is not supported.
     return true;
 }
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2017, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -85,6 +85,8 @@ protected:
     // Native Handle for Java object.
     JGObject m_nativeDecoder;
     mutable IntSize m_size;
+    // Segments of the encoded data the Java decoder holds direct views of.
+    Vector<SharedBufferDataView> m_dataViews;
 };
 
 } // namespace WebCore
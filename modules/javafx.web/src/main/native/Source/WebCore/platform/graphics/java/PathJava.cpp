@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -35,10 +35,14 @@
 #include "GraphicsContext.h"
 #include "ImageBuffer.h"
 #include "PathStream.h"
+#include "RenderingQueue.h"
 
+#include <bit>
+#include <wtf/MathExtras.h>
 #include <wtf/text/WTFString.h>
 #include <wtf/java/JavaRef.h>
 
+#include "com_sun_webkit_graphics_WCPath.h"
 #include "com_sun_webkit_graphics_WCPathIterator.h"
 
 namespace WebCore {
@@ -94,55 +98,67 @@ static GraphicsContext& scratchContext()
     return context;
 }
 
-RefPtr<RQRef> copyPath(RefPtr<RQRef> p)
+PathJava::PathJava()
+    : m_packedSegments({ 0 })
+    , m_elementsStream(PathStream::create())
 {
-    if (!p) {
-        return createEmptyPath();
-    }
-    JNIEnv* env = WTF::GetJavaEnv();
-
-    static jmethodID mid = env->GetMethodID(PG_GetGraphicsManagerClass(env),
-        "createWCPath",
-        "(Lcom/sun/webkit/graphics/WCPath;)Lcom/sun/webkit/graphics/WCPath;");
-    ASSERT(mid);
-
-    JLObject ref(env->CallObjectMethod(PL_GetGraphicsManager(env), mid, (jobject)*p));
-    ASSERT(ref);
-    WTF::CheckAndClearException(env);
-
-    return RQRef::create(ref);
 }
 
-Ref<PathJava> PathJava::create(RefPtr<RQRef>&& platformPath, RefPtr<PathStream>&& elementsStream)
+PathJava::PathJava(const PathJava& other)
+    : PathImpl()
+    , m_packedSegments(other.m_packedSegments)
+    , m_drawingSegmentCount(other.m_drawingSegmentCount)
+    , m_elementsStream(downcast<PathStream>(other.m_elementsStream->copy()))
+    , m_hasNativeGeometry(other.m_hasNativeGeometry)
 {
-    return adoptRef(*new PathJava(WTF::move(platformPath), WTF::move(elementsStream)));
 }
 
-PathJava::PathJava()
-    : m_platformPath(createEmptyPath())
-    , m_elementsStream(PathStream::create())
+Ref<PathImpl> PathJava::copy() const
 {
+    return adoptRef(*new PathJava(*this));
 }
 
-PathJava::PathJava(RefPtr<RQRef>&& platformPath, RefPtr<PathStream>&& elementsStream)
-    : m_platformPath(WTF::move(platformPath))
-    , m_elementsStream(WTF::move(elementsStream))
+PlatformPathPtr PathJava::platformPath() const
 {
-    ASSERT(m_platformPath);
-}
+    if (m_platformPath)
+        return m_platformPath;
 
-Ref<PathImpl> PathJava::copy() const
-{
-    auto platformPathCopy = createEmptyPath();
+    m_platformPath = createEmptyPath();
+    if (!m_packedSegments[0])
+        return m_platformPath;
 
-    auto elementsStream = m_elementsStream ? RefPtr<PathImpl> { m_elementsStream->copy() } : nullptr;
+    JNIEnv* env = WTF::GetJavaEnv();
 
-    return PathJava::create(WTF::move(platformPathCopy), downcast<PathStream>(WTF::move(elementsStream)));
+    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env), "addSegments",
+        "(Ljava/nio/ByteBuffer;)V");
+    ASSERT(mid);
+
+    // The buffer is only read during the call, so it may refer to the vector.
+    JLObject buffer(env->NewDirectByteBuffer(const_cast<jint*>(m_packedSegments.span().data()), serializedSize()));
+    env->CallVoidMethod(*m_platformPath, mid, (jobject)buffer);
+    WTF::CheckAndClearException(env);
+
+    return m_platformPath;
 }
 
-PlatformPathPtr PathJava::platformPath() const
+void PathJava::serializeSegments(RenderingQueue& rq) const
+{
+    rq << m_packedSegments.span();
+}
+
+void PathJava::appendSegment(jint kind, std::initializer_list<float> arguments, std::optional<jint> flag)
 {
-    return m_platformPath.get();
+    m_packedSegments.append(kind);
+    for (float argument : arguments)
+        m_packedSegments.append(std::bit_cast<jint>(argument));
+    if (flag)
+        m_packedSegments.append(*flag);
+    ++m_packedSegments[0];
+    if (kind != com_sun_webkit_graphics_WCPath_SEGMENT_TRANSFORM)
+        ++m_drawingSegmentCount;
+
+    // The Java path, if any, is rebuilt from the segments when needed again.
+    m_platformPath = nullptr;
 }
 
 bool PathJava::definitelyEqual(const PathImpl& otherImpl) const
@@ -153,7 +169,7 @@ bool PathJava::definitelyEqual(const PathImpl& otherImpl) const
     }
     if (otherAsPathJava.get() == this)
         return true;
-    return m_platformPath == otherAsPathJava->m_platformPath;
+    return m_packedSegments == otherAsPathJava->m_packedSegments;
 }
 void PathJava::add(PathContinuousRoundedRect continuousRoundedRect)
 {
@@ -162,106 +178,51 @@ void PathJava::add(PathContinuousRoundedRect continuousRoundedRect)
 
 void PathJava::add(PathMoveTo moveto)
 {
-    ASSERT(m_platformPath);
-
-    JNIEnv* env = WTF::GetJavaEnv();
-
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env), "moveTo",
-        "(DD)V");
-    ASSERT(mid);
-
-    env->CallVoidMethod(*m_platformPath, mid, (jdouble)moveto.point.x(), (jdouble)moveto.point.y());
-    WTF::CheckAndClearException(env);
+    m_elementsStream->add(moveto);
+    appendSegment(com_sun_webkit_graphics_WCPath_SEGMENT_MOVETO,
+        { moveto.point.x(), moveto.point.y() });
 }
 
 void PathJava::add(PathLineTo lineTo)
 {
-    ASSERT(m_platformPath);
-
-    JNIEnv* env = WTF::GetJavaEnv();
-
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env), "addLineTo",
-        "(DD)V");
-    ASSERT(mid);
-
-    env->CallVoidMethod(*m_platformPath, mid, (jdouble)lineTo.point.x(), (jdouble)lineTo.point.y());
-    WTF::CheckAndClearException(env);
+    m_elementsStream->add(lineTo);
+    appendSegment(com_sun_webkit_graphics_WCPath_SEGMENT_LINETO,
+        { lineTo.point.x(), lineTo.point.y() });
 }
 
 void PathJava::add(PathQuadCurveTo quadTo)
 {
-    ASSERT(m_platformPath);
-
-    JNIEnv* env = WTF::GetJavaEnv();
-
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env), "addQuadCurveTo",
-                                            "(DDDD)V");
-    ASSERT(mid);
-
-    env->CallVoidMethod(*m_platformPath, mid, (jdouble)quadTo.controlPoint.x(), (jdouble)quadTo.controlPoint.y(), (jdouble)quadTo.endPoint.x(), (jdouble)quadTo.endPoint.y());
-    WTF::CheckAndClearException(env);
+    m_elementsStream->add(quadTo);
+    appendSegment(com_sun_webkit_graphics_WCPath_SEGMENT_QUADTO,
+        { quadTo.controlPoint.x(), quadTo.controlPoint.y(), quadTo.endPoint.x(), quadTo.endPoint.y() });
 }
 
 void PathJava::add(PathBezierCurveTo bezierTo)
 {
-    ASSERT(m_platformPath);
-
-    JNIEnv* env = WTF::GetJavaEnv();
-
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env),
-        "addBezierCurveTo", "(DDDDDD)V");
-    ASSERT(mid);
-
-    env->CallVoidMethod(*m_platformPath, mid,
-                        (jdouble)bezierTo.controlPoint1.x(), (jdouble)bezierTo.controlPoint1.y(),
-                        (jdouble)bezierTo.controlPoint2.x(), (jdouble)bezierTo.controlPoint2.y(),
-                        (jdouble)bezierTo.endPoint.x(), (jdouble)bezierTo.endPoint.y());
-    WTF::CheckAndClearException(env);
-}
-
-static inline float areaOfTriangleFormedByPoints(const FloatPoint& p1, const FloatPoint& p2, const FloatPoint& p3)
-{
-    return p1.x() * (p2.y() - p3.y()) + p2.x() * (p3.y() - p1.y()) + p3.x() * (p1.y() - p2.y());
+    m_elementsStream->add(bezierTo);
+    appendSegment(com_sun_webkit_graphics_WCPath_SEGMENT_CUBICTO,
+        { bezierTo.controlPoint1.x(), bezierTo.controlPoint1.y(),
+          bezierTo.controlPoint2.x(), bezierTo.controlPoint2.y(),
+          bezierTo.endPoint.x(), bezierTo.endPoint.y() });
 }
 
 void PathJava::add(PathArcTo arcTo)
 {
-    ASSERT(m_platformPath);
-
-    JNIEnv* env = WTF::GetJavaEnv();
-
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env), "addArcTo",
-        "(DDDDD)V");
-    ASSERT(mid);
-
-    env->CallVoidMethod(*m_platformPath, mid,
-                        (jdouble)arcTo.controlPoint1.x(), (jdouble)arcTo.controlPoint1.y(),
-                        (jdouble)arcTo.controlPoint2.x(), (jdouble)arcTo.controlPoint2.y(), (jdouble)arcTo.radius);
-    WTF::CheckAndClearException(env);
+    m_elementsStream->add(arcTo);
+    appendSegment(com_sun_webkit_graphics_WCPath_SEGMENT_ARCTO,
+        { arcTo.controlPoint1.x(), arcTo.controlPoint1.y(),
+          arcTo.controlPoint2.x(), arcTo.controlPoint2.y(), arcTo.radius });
 }
 
 void PathJava::add(PathArc arc)
 {
-    ASSERT(m_platformPath);
-    bool clockwise = false;
-    const RotationDirection direction = arc.direction;
-    if (direction == RotationDirection::Counterclockwise) {
-        clockwise = true;
-    } else if (direction == RotationDirection::Clockwise) {
-        clockwise = false;
-    }
-
-    JNIEnv* env = WTF::GetJavaEnv();
-
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env), "addArc",
-        "(DDDDDZ)V");
-    ASSERT(mid);
-
-    env->CallVoidMethod(*m_platformPath, mid, (jdouble)arc.center.x(), (jdouble)arc.center.y(),
-        (jdouble)arc.radius, (jdouble)arc.startAngle, (jdouble)arc.endAngle,
-        bool_to_jbool(clockwise));
-    WTF::CheckAndClearException(env);
+    m_elementsStream->add(arc);
+    // WCPath.addArc() takes an anticlockwise flag.
+    appendSegment(com_sun_webkit_graphics_WCPath_SEGMENT_ARC,
+        { arc.center.x(), arc.center.y(), arc.radius, arc.startAngle, arc.endAngle },
+        arc.direction == RotationDirection::Counterclockwise ? 1 : 0);
 }
+
 void PathJava::add(PathClosedArc closedArc)
 {
     notImplemented();
@@ -274,32 +235,17 @@ void PathJava::add(PathEllipse ellipse)
 
 void PathJava::add(PathEllipseInRect ellipseInRect)
 {
-    ASSERT(m_platformPath);
-
-    JNIEnv* env = WTF::GetJavaEnv();
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env), "addEllipse",
-        "(DDDD)V");
-    ASSERT(mid);
-
-    env->CallVoidMethod(*m_platformPath, mid,
-                        (jdouble)ellipseInRect.rect.x(), (jdouble)ellipseInRect.rect.y(),
-                        (jdouble)ellipseInRect.rect.width(), (jdouble)ellipseInRect.rect.height());
-    WTF::CheckAndClearException(env);
+    m_elementsStream->add(ellipseInRect);
+    appendSegment(com_sun_webkit_graphics_WCPath_SEGMENT_ELLIPSE,
+        { ellipseInRect.rect.x(), ellipseInRect.rect.y(),
+          ellipseInRect.rect.width(), ellipseInRect.rect.height() });
 }
 
 void PathJava::add(PathRect rect)
 {
-    ASSERT(m_platformPath);
-
-    JNIEnv* env = WTF::GetJavaEnv();
-
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env), "addRect",
-        "(DDDD)V");
-    ASSERT(mid);
-
-    env->CallVoidMethod(*m_platformPath, mid, (jdouble)rect.rect.x(), (jdouble)rect.rect.y(),
-                              (jdouble)rect.rect.width(), (jdouble)rect.rect.height());
-    WTF::CheckAndClearException(env);
+    m_elementsStream->add(rect);
+    appendSegment(com_sun_webkit_graphics_WCPath_SEGMENT_RECT,
+        { rect.rect.x(), rect.rect.y(), rect.rect.width(), rect.rect.height() });
 }
 
 void PathJava::add(PathRoundedRect roundedRect)
@@ -308,76 +254,61 @@ void PathJava::add(PathRoundedRect roundedRect)
         addSegment(segment);
 }
 
-void PathJava::add(PathCloseSubpath)
+void PathJava::add(PathCloseSubpath closeSubpath)
 {
-    ASSERT(m_platformPath);
-
-    JNIEnv* env = WTF::GetJavaEnv();
-
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env),
-        "closeSubpath", "()V");
-    ASSERT(mid);
-
-    env->CallVoidMethod(*m_platformPath, mid);
-    WTF::CheckAndClearException(env);
+    m_elementsStream->add(closeSubpath);
+    appendSegment(com_sun_webkit_graphics_WCPath_SEGMENT_CLOSE, { });
 }
 
 void PathJava::addPath(const PathJava& path, const AffineTransform& transform)
 {
-    notImplemented();
+    auto segments = path.m_elementsStream->copy();
+    if (path.m_hasNativeGeometry && segments->transform(transform)) {
+        for (auto& segment : downcast<PathStream>(segments.get()).segments())
+            addSegment(segment);
+        return;
+    }
+
+    if (path.isEmpty())
+        return;
+
+    // Arcs, ellipses and rects cannot be transformed in place, so the
+    // source segments are nested as they are and appended by the Java path,
+    // which also answers the geometry queries from now on.
+    Vector<jint> nestedSegments = path.m_packedSegments;
+    unsigned nestedDrawingSegmentCount = path.m_drawingSegmentCount;
+    appendSegment(com_sun_webkit_graphics_WCPath_SEGMENT_PATH,
+        { static_cast<float>(transform.a()), static_cast<float>(transform.b()),
+          static_cast<float>(transform.c()), static_cast<float>(transform.d()),
+          static_cast<float>(transform.e()), static_cast<float>(transform.f()) });
+    m_packedSegments.appendVector(nestedSegments);
+    // The nested segment itself is not counted as drawing, its contents are.
+    m_drawingSegmentCount += nestedDrawingSegmentCount - 1;
+    m_hasNativeGeometry = false;
 }
 
 void PathJava::applySegments(const PathSegmentApplier& applier) const
 {
-    applyElements([&](const PathElement& pathElement) {
-        switch (pathElement.type) {
-        case PathElement::Type::MoveToPoint:
-            applier({ PathMoveTo { pathElement.points[0] } });
-            break;
-
-        case PathElement::Type::AddLineToPoint:
-            applier({ PathLineTo { pathElement.points[0] } });
-            break;
-
-        case PathElement::Type::AddQuadCurveToPoint:
-            applier({ PathQuadCurveTo { pathElement.points[0], pathElement.points[1] } });
-            break;
-
-        case PathElement::Type::AddCurveToPoint:
-            applier({ PathBezierCurveTo { pathElement.points[0], pathElement.points[1], pathElement.points[2] } });
-            break;
-
-        case PathElement::Type::CloseSubpath:
-            applier({ PathCloseSubpath { } });
-            break;
-        }
-    });
+    if (m_hasNativeGeometry)
+        m_elementsStream->applySegments(applier);
 }
 
 bool PathJava::applyElements(const PathElementApplier& applier) const
 {
-    // need to implement this method after looking into cairo implementation
-    return true;
+    return m_hasNativeGeometry && m_elementsStream->applyElements(applier);
 }
 
 bool PathJava::isEmpty() const
 {
-    ASSERT(m_platformPath);
-
-    JNIEnv* env = WTF::GetJavaEnv();
-
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env),
-                                            "isEmpty", "()Z");
-    ASSERT(mid);
-
-    jboolean res = env->CallBooleanMethod(*m_platformPath, mid);
-    WTF::CheckAndClearException(env);
-
-    return jbool_to_bool(res);
+    // Transforms alone do not draw anything.
+    return !m_drawingSegmentCount;
 }
 
 FloatPoint PathJava::currentPoint() const
 {
+    if (m_hasNativeGeometry)
+        return static_cast<const PathImpl&>(m_elementsStream.get()).currentPoint();
+
     //utatodo: return current point of subpath.
     float quietNaN = std::numeric_limits<float>::quiet_NaN();
     return FloatPoint(quietNaN, quietNaN);
@@ -385,28 +316,168 @@ FloatPoint PathJava::currentPoint() const
 
 bool PathJava::transform(const AffineTransform& transform)
 {
-    ASSERT(m_platformPath);
-
-    JNIEnv* env = WTF::GetJavaEnv();
+    // Arcs, ellipses and rects cannot be transformed in place, in which
+    // case the geometry is taken from the (transformed) Java path.
+    if (m_hasNativeGeometry && !m_elementsStream->transform(transform))
+        m_hasNativeGeometry = false;
 
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env),
-        "transform", "(DDDDDD)V");
-    ASSERT(mid);
-
-    env->CallVoidMethod(*m_platformPath, mid,
-                        (jdouble)transform.a(), (jdouble)transform.b(),
-                        (jdouble)transform.c(), (jdouble)transform.d(),
-                        (jdouble)transform.e(), (jdouble)transform.f());
-    WTF::CheckAndClearException(env);
+    appendSegment(com_sun_webkit_graphics_WCPath_SEGMENT_TRANSFORM,
+        { static_cast<float>(transform.a()), static_cast<float>(transform.b()),
+          static_cast<float>(transform.c()), static_cast<float>(transform.d()),
+          static_cast<float>(transform.e()), static_cast<float>(transform.f()) });
     return true;
 }
 
+namespace {
+
+// Computes the winding of a path around a point by casting a ray in
+// the +x direction. Curves are flattened to line segments.
+class WindingCounter {
+public:
+    explicit WindingCounter(const FloatPoint& point)
+        : m_point(point)
+    {
+    }
+
+    void moveTo(const FloatPoint& point)
+    {
+        closeSubpath();
+        m_current = m_subpathStart = point;
+    }
+
+    void lineTo(const FloatPoint& point)
+    {
+        addEdge(m_current, point);
+        m_current = point;
+    }
+
+    void quadTo(const FloatPoint& control, const FloatPoint& end)
+    {
+        FloatPoint start = m_current;
+        unsigned steps = flatteningSteps(start, control, control, end);
+        for (unsigned i = 1; i <= steps; ++i) {
+            float t = static_cast<float>(i) / steps;
+            float mt = 1 - t;
+            lineTo(FloatPoint(
+                mt * mt * start.x() + 2 * mt * t * control.x() + t * t * end.x(),
+                mt * mt * start.y() + 2 * mt * t * control.y() + t * t * end.y()));
+        }
+    }
+
+    void cubicTo(const FloatPoint& control1, const FloatPoint& control2, const FloatPoint& end)
+    {
+        FloatPoint start = m_current;
+        unsigned steps = flatteningSteps(start, control1, control2, end);
+        for (unsigned i = 1; i <= steps; ++i) {
+            float t = static_cast<float>(i) / steps;
+            float mt = 1 - t;
+            float a = mt * mt * mt;
+            float b = 3 * mt * mt * t;
+            float c = 3 * mt * t * t;
+            float d = t * t * t;
+            lineTo(FloatPoint(
+                a * start.x() + b * control1.x() + c * control2.x() + d * end.x(),
+                a * start.y() + b * control1.y() + c * control2.y() + d * end.y()));
+        }
+    }
+
+    void closeSubpath()
+    {
+        if (m_current != m_subpathStart)
+            addEdge(m_current, m_subpathStart);
+        m_current = m_subpathStart;
+    }
+
+    bool contains(WindRule rule)
+    {
+        closeSubpath();
+        return rule == WindRule::EvenOdd ? (m_crossings & 1) : m_winding;
+    }
+
+private:
+    static unsigned flatteningSteps(const FloatPoint& p0, const FloatPoint& p1, const FloatPoint& p2, const FloatPoint& p3)
+    {
+        float length = (p1 - p0).diagonalLength() + (p2 - p1).diagonalLength() + (p3 - p2).diagonalLength();
+        return clampTo<unsigned>(std::ceil(length / 4), 4, 64);
+    }
+
+    void addEdge(const FloatPoint& a, const FloatPoint& b)
+    {
+        float side = (b.x() - a.x()) * (m_point.y() - a.y()) - (m_point.x() - a.x()) * (b.y() - a.y());
+        if (a.y() <= m_point.y()) {
+            if (b.y() > m_point.y() && side > 0) {
+                ++m_winding;
+                ++m_crossings;
+            }
+        } else if (b.y() <= m_point.y() && side < 0) {
+            --m_winding;
+            ++m_crossings;
+        }
+    }
+
+    FloatPoint m_point;
+    FloatPoint m_current;
+    FloatPoint m_subpathStart;
+    int m_winding { 0 };
+    unsigned m_crossings { 0 };
+};
+
+} // namespace
+
 bool PathJava::contains(const FloatPoint &point, WindRule rule) const
 {
     if (isEmpty() || !std::isfinite(point.x()) || !std::isfinite(point.y()))
         return false;
 
-    ASSERT(m_platformPath);
+    if (m_hasNativeGeometry) {
+        WindingCounter counter(point);
+        bool flattened = true;
+        for (auto& segment : m_elementsStream->segments()) {
+            WTF::switchOn(segment.data(),
+                [&](const PathMoveTo& data) {
+                    counter.moveTo(data.point);
+                },
+                [&](const PathLineTo& data) {
+                    counter.lineTo(data.point);
+                },
+                [&](const PathQuadCurveTo& data) {
+                    counter.quadTo(data.controlPoint, data.endPoint);
+                },
+                [&](const PathBezierCurveTo& data) {
+                    counter.cubicTo(data.controlPoint1, data.controlPoint2, data.endPoint);
+                },
+                [&](const PathCloseSubpath&) {
+                    counter.closeSubpath();
+                },
+                [&](const PathRect& data) {
+                    counter.moveTo(data.rect.minXMinYCorner());
+                    counter.lineTo(data.rect.maxXMinYCorner());
+                    counter.lineTo(data.rect.maxXMaxYCorner());
+                    counter.lineTo(data.rect.minXMaxYCorner());
+                    counter.closeSubpath();
+                },
+                [&](const PathEllipseInRect& data) {
+                    const FloatRect& r = data.rect;
+                    float kx = r.width() / 2 * circleControlPoint();
+                    float ky = r.height() / 2 * circleControlPoint();
+                    FloatPoint c = r.center();
+                    counter.moveTo(FloatPoint(r.maxX(), c.y()));
+                    counter.cubicTo(FloatPoint(r.maxX(), c.y() + ky), FloatPoint(c.x() + kx, r.maxY()), FloatPoint(c.x(), r.maxY()));
+                    counter.cubicTo(FloatPoint(c.x() - kx, r.maxY()), FloatPoint(r.x(), c.y() + ky), FloatPoint(r.x(), c.y()));
+                    counter.cubicTo(FloatPoint(r.x(), c.y() - ky), FloatPoint(c.x() - kx, r.y()), FloatPoint(c.x(), r.y()));
+                    counter.cubicTo(FloatPoint(c.x() + kx, r.y()), FloatPoint(r.maxX(), c.y() - ky), FloatPoint(r.maxX(), c.y()));
+                    counter.closeSubpath();
+                },
+                [&](const auto&) {
+                    // Arcs are hit tested by the Java path.
+                    flattened = false;
+                });
+            if (!flattened)
+                break;
+        }
+        if (flattened)
+            return counter.contains(rule);
+    }
 
     JNIEnv* env = WTF::GetJavaEnv();
 
@@ -414,7 +485,7 @@ bool PathJava::contains(const FloatPoint &point, WindRule rule) const
         "(IDD)Z");
     ASSERT(mid);
 
-    jboolean res = env->CallBooleanMethod(*m_platformPath, mid, (jint)rule,
+    jboolean res = env->CallBooleanMethod(*platformPath(), mid, (jint)rule,
         (jdouble)point.x(), (jdouble)point.y());
     WTF::CheckAndClearException(env);
 
@@ -423,7 +494,6 @@ bool PathJava::contains(const FloatPoint &point, WindRule rule) const
 
 bool PathJava::strokeContains(const FloatPoint& p, const Function<void(GraphicsContext&)>& strokeStyleApplier) const
 {
-    ASSERT(m_platformPath);
     ASSERT(strokeStyleApplier);
 
     GraphicsContext& gc = scratchContext();
@@ -455,7 +525,7 @@ bool PathJava::strokeContains(const FloatPoint& p, const Function<void(GraphicsC
     JLocalRef<jdoubleArray> dashArray(env->NewDoubleArray(size));
     env->SetDoubleArrayRegion(dashArray, 0, size, dashes.span().data());
 
-    jboolean res = env->CallBooleanMethod(*m_platformPath, mid, (jdouble)p.x(),
+    jboolean res = env->CallBooleanMethod(*platformPath(), mid, (jdouble)p.x(),
         (jdouble)p.y(), (jdouble) thickness, (jdouble) miterLimit,
         (jint) cap, (jint) join, (jdouble) dashOffset, (jdoubleArray) dashArray);
 
@@ -466,56 +536,61 @@ bool PathJava::strokeContains(const FloatPoint& p, const Function<void(GraphicsC
 
 FloatRect PathJava::fastBoundingRect() const
 {
-    return boundingRect();
+    if (m_hasNativeGeometry)
+        return m_elementsStream->fastBoundingRect();
+    return javaBoundingRect();
 }
 
 FloatRect PathJava::boundingRect() const
 {
-    return strokeBoundingRect(nullptr);
+    if (m_hasNativeGeometry)
+        return m_elementsStream->boundingRect();
+    return javaBoundingRect();
 }
 
 FloatRect PathJava::strokeBoundingRect(const Function<void(GraphicsContext&)>& strokeStyleApplier) const
 {
-    ASSERT(m_platformPath);
+    FloatRect bounds = boundingRect();
+    if (strokeStyleApplier) {
+        GraphicsContext& gc = scratchContext();
+        gc.save();
+        strokeStyleApplier(gc);
+        float thickness = gc.strokeThickness();
+        gc.restore();
+        bounds.inflate(thickness / 2);
+    }
+    return bounds;
+}
 
+FloatRect PathJava::javaBoundingRect() const
+{
     JNIEnv* env = WTF::GetJavaEnv();
 
     static jmethodID mid = env->GetMethodID(PG_GetPathClass(env), "getBounds",
             "()Lcom/sun/webkit/graphics/WCRectangle;");
     ASSERT(mid);
 
-    JLObject rect(env->CallObjectMethod(*m_platformPath, mid));
+    JLObject rect(env->CallObjectMethod(*platformPath(), mid));
     WTF::CheckAndClearException(env);
-    if (rect) {
-        static jfieldID rectxFID = env->GetFieldID(PG_GetRectangleClass(env), "x", "F");
-        ASSERT(rectxFID);
-        static jfieldID rectyFID = env->GetFieldID(PG_GetRectangleClass(env), "y", "F");
-        ASSERT(rectyFID);
-        static jfieldID rectwFID = env->GetFieldID(PG_GetRectangleClass(env), "w", "F");
-        ASSERT(rectwFID);
-        static jfieldID recthFID = env->GetFieldID(PG_GetRectangleClass(env), "h", "F");
-        ASSERT(recthFID);
-
-        FloatRect bounds(
-            float(env->GetFloatField(rect, rectxFID)),
-            float(env->GetFloatField(rect, rectyFID)),
-            float(env->GetFloatField(rect, rectwFID)),
-            float(env->GetFloatField(rect, recthFID)));
-        WTF::CheckAndClearException(env);
-
-        float thickness;
-        if (strokeStyleApplier) {
-            GraphicsContext& gc = scratchContext();
-            gc.save();
-            strokeStyleApplier(gc);
-            thickness = gc.strokeThickness();
-            gc.restore();
-            bounds.inflate(thickness / 2);
-        }
-        return bounds;
-    } else {
+    if (!rect)
         return FloatRect();
-    }
+
+    static jfieldID rectxFID = env->GetFieldID(PG_GetRectangleClass(env), "x", "F");
+    ASSERT(rectxFID);
+    static jfieldID rectyFID = env->GetFieldID(PG_GetRectangleClass(env), "y", "F");
+    ASSERT(rectyFID);
+    static jfieldID rectwFID = env->GetFieldID(PG_GetRectangleClass(env), "w", "F");
+    ASSERT(rectwFID);
+    static jfieldID recthFID = env->GetFieldID(PG_GetRectangleClass(env), "h", "F");
+    ASSERT(recthFID);
+
+    FloatRect bounds(
+        float(env->GetFloatField(rect, rectxFID)),
+        float(env->GetFloatField(rect, rectyFID)),
+        float(env->GetFloatField(rect, rectwFID)),
+        float(env->GetFloatField(rect, recthFID)));
+    WTF::CheckAndClearException(env);
+    return bounds;
 }
 
 } // namespace WebCore
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2023, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -31,23 +31,35 @@
 #include "RQRef.h"
 #include "WindRule.h"
 
+#include <jni.h>
+#include <optional>
+#include <wtf/Vector.h>
+
 namespace WebCore {
 
 class GraphicsContext;
 class PathStream;
+class RenderingQueue;
 
+// The segments are kept on the native side, both as a PathStream for the
+// geometry queries and in the packed format understood by
+// WCPath.addSegments(). The Java WCPath is only created when it is
+// actually needed (e.g. for strokeContains); drawing sends the packed
+// segments through the rendering queue instead.
 class PathJava final : public PathImpl {
 public:
     static Ref<PathJava> create();
     static Ref<PathJava> create(std::span<const PathSegment> segments);
-    static Ref<PathJava> create(RefPtr<RQRef>&&, RefPtr<PathStream>&& = nullptr);
 
     PathJava();
-    PathJava(RefPtr<RQRef>&&, RefPtr<PathStream>&&);
 
     PlatformPathPtr platformPath() const;
     static PlatformPathPtr emptyPlatformPath();
 
+    // Writes the number of segments followed by the packed segments.
+    void serializeSegments(RenderingQueue&) const;
+    size_t serializedSize() const { return m_packedSegments.size() * sizeof(jint); }
+
     void addPath(const PathJava&, const AffineTransform&);
     bool definitelyEqual(const PathImpl&) const final;
 
@@ -61,6 +73,8 @@ public:
     FloatRect strokeBoundingRect(const Function<void(GraphicsContext&)>& strokeStyleApplier) const;
 
 private:
+    PathJava(const PathJava&);
+
     Ref<PathImpl> copy() const final;
     void add(PathMoveTo) final;
     void add(PathLineTo) final;
@@ -85,8 +99,18 @@ private:
     FloatRect fastBoundingRect() const final;
     FloatRect boundingRect() const final;
 
-    RefPtr<RQRef> m_platformPath;
-    RefPtr<PathStream> m_elementsStream;
+    void appendSegment(jint kind, std::initializer_list<float> arguments, std::optional<jint> flag = std::nullopt);
+    FloatRect javaBoundingRect() const;
+
+    // m_packedSegments[0] is the number of segments that follow.
+    Vector<jint> m_packedSegments;
+    // Number of the packed segments other than transforms.
+    unsigned m_drawingSegmentCount { 0 };
+    Ref<PathStream> m_elementsStream;
+    // False once a transform could not be applied to m_elementsStream;
+    // the Java path is queried for the geometry from then on.
+    bool m_hasNativeGeometry { true };
+    mutable RefPtr<RQRef> m_platformPath;
 };
 
 } // namespace WebCore
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2019, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -25,16 +25,30 @@
 
 #pragma once
 
+#include "Color.h"
+#include "FloatRect.h"
 #include "GraphicsContext.h"
 #include "Path.h"
 #include "RenderingQueue.h"
+#include "com_sun_webkit_graphics_GraphicsDecoder.h"
 #include "com_sun_webkit_graphics_WCRenderQueue.h"
 #include <jni.h>
+#include <optional>
 #include <wtf/Noncopyable.h>
+#include <wtf/Vector.h>
 
 namespace WebCore {
 
-    RefPtr<RQRef> copyPath(RefPtr<RQRef> p);
+    // The last values sent to the Java graphics context for one save level.
+    // An empty value means that the Java side state is unknown.
+    struct PlatformStateShadow {
+        std::optional<Color> fillColor;
+        std::optional<Color> strokeColor;
+        std::optional<float> strokeThickness;
+        std::optional<float> alpha;
+        std::optional<CompositeOperator> compositeOperator;
+        std::optional<FloatRect> clipRect;
+    };
 
     class PlatformContextJava {
         WTF_MAKE_NONCOPYABLE(PlatformContextJava);
@@ -48,10 +62,88 @@ namespace WebCore {
             : PlatformContextJava(jRQ, nullptr, autoFlush)
         {}
 
-        RenderingQueue& rq() const {
+        // The queue drawing commands are written to. Anything written may
+        // depend on the saved state, so the deferred SAVESTATE commands go
+        // first. Use queue() to inspect or flush the queue instead.
+        RenderingQueue& rq() {
+            flushPendingSaves();
+            return *m_rq;
+        }
+
+        RenderingQueue& queue() const {
             return *m_rq;
         }
 
+        // Sends the SAVESTATE commands deferred by saveState().
+        void flushPendingSaves() {
+            while (m_pendingSaveCount) {
+                --m_pendingSaveCount;
+                m_rq->freeSpace(4)
+                << (jint)com_sun_webkit_graphics_GraphicsDecoder_SAVESTATE;
+            }
+        }
+
+        // SAVESTATE is deferred until something is actually written to
+        // the queue, so that empty save/restore pairs are not sent at all.
+        void saveState() {
+            m_shadowStateStack.append(m_shadowState);
+            ++m_pendingSaveCount;
+        }
+
+        // Returns false if the matching SAVESTATE has never been sent, so
+        // there is no need to send RESTORESTATE either.
+        bool restoreState() {
+            if (!m_shadowStateStack.isEmpty())
+                m_shadowState = m_shadowStateStack.takeLast();
+            else
+                m_shadowState = { };
+
+            if (m_pendingSaveCount) {
+                --m_pendingSaveCount;
+                m_elidedCommandCount += 2;
+                return false;
+            }
+            return true;
+        }
+
+        // Transparency layers reset part of the Java state, so the layer
+        // starts with an unknown state and restores the outer one at its end.
+        void beginLayer() {
+            m_shadowStateStack.append(m_shadowState);
+            m_shadowState = { };
+        }
+
+        void endLayer() {
+            m_shadowState = m_shadowStateStack.isEmpty() ? PlatformStateShadow { } : m_shadowStateStack.takeLast();
+        }
+
+        void resetState() {
+            m_shadowState = { };
+        }
+
+        // Records [value] as the current value of [member] and returns true
+        // if it differs from what the Java side already has.
+        template<typename T>
+        bool updateState(std::optional<T> PlatformStateShadow::*member, const T& value) {
+            std::optional<T>& current = m_shadowState.*member;
+            if (current && *current == value) {
+                ++m_elidedCommandCount;
+                return false;
+            }
+            current = value;
+            return true;
+        }
+
+        template<typename T>
+        void invalidateState(std::optional<T> PlatformStateShadow::*member) {
+            (m_shadowState.*member).reset();
+        }
+
+        // Number of queue commands dropped as redundant, for profiling.
+        unsigned elidedCommandCount() const {
+            return m_elidedCommandCount;
+        }
+
         RefPtr<RenderingQueue> rq_ref() {
             return m_rq;
         }
@@ -130,5 +222,10 @@ namespace WebCore {
         LineCap m_lineCap { };
         LineJoin m_lineJoin { };
         float m_miterLimit { };
+
+        PlatformStateShadow m_shadowState;
+        Vector<PlatformStateShadow> m_shadowStateStack;
+        unsigned m_pendingSaveCount { 0 };
+        unsigned m_elidedCommandCount { 0 };
     };
 }
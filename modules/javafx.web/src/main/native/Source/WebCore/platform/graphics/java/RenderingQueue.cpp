@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2019, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -33,6 +33,7 @@
 #include <wtf/HashMap.h>
 #include <wtf/NeverDestroyed.h>
 
+#include "com_sun_webkit_graphics_GraphicsDecoder.h"
 #include "com_sun_webkit_graphics_WCRenderQueue.h"
 
 namespace WebCore {
@@ -45,6 +46,48 @@ static Addr2ByteBuffer& getAddr2ByteBuffer()
     return container.get();
 }
 
+// Requests below this size share the smallest size class.
+static const int MIN_POOLED_BLOCK_SIZE = 0x1000;
+
+ByteBufferPool& ByteBufferPool::singleton()
+{
+    static NeverDestroyed<ByteBufferPool> pool;
+    return pool.get();
+}
+
+char* ByteBufferPool::acquire(int& capacity)
+{
+    capacity = static_cast<int>(roundUpToPowerOfTwo(static_cast<unsigned>(std::max(capacity, MIN_POOLED_BLOCK_SIZE))));
+
+    Locker locker { m_lock };
+    ++m_buffersInFlight;
+    m_bytesInFlight += capacity;
+
+    auto it = m_freeLists.find(capacity);
+    if (it != m_freeLists.end() && !it->value.isEmpty()) {
+        m_bytesHeld -= capacity;
+        return it->value.takeLast();
+    }
+    return new char[capacity];
+}
+
+void ByteBufferPool::recycle(char* block, int capacity)
+{
+    Locker locker { m_lock };
+    ASSERT(m_buffersInFlight && m_bytesInFlight >= static_cast<size_t>(capacity));
+    --m_buffersInFlight;
+    m_bytesInFlight -= capacity;
+
+    if (m_bytesHeld + capacity > MAX_POOLED_BYTES) {
+        delete[] block;
+        return;
+    }
+    m_freeLists.ensure(capacity, [] {
+        return Vector<char*>();
+    }).iterator->value.append(block);
+    m_bytesHeld += capacity;
+}
+
 /*static*/
 RefPtr<RenderingQueue> RenderingQueue::create(
     const JLObject &jRQ,
@@ -57,11 +100,23 @@ RefPtr<RenderingQueue> RenderingQueue::create(
         autoFlush));
 }
 
+bool RenderingQueue::s_defersAutoFlush = false;
+int RenderingQueue::s_encodingVersion = com_sun_webkit_graphics_GraphicsDecoder_ENCODING_VERSION;
+
 RenderingQueue& RenderingQueue::freeSpace(int size) {
     if (m_buffer && !m_buffer->hasFreeSpace(size)) {
-        flushBuffer();
-        if (m_autoFlush) {
-            flush();
+        if (m_autoFlush && s_defersAutoFlush) {
+            m_deferredSize += m_buffer->size();
+            m_deferredBuffers.append(WTF::move(m_buffer));
+            if (m_deferredSize >= MAX_DEFERRED_SIZE) {
+                flushBuffer();
+                flush();
+            }
+        } else {
+            flushBuffer();
+            if (m_autoFlush) {
+                flush();
+            }
         }
     }
     if (!m_buffer) {
@@ -103,6 +158,23 @@ RenderingQueue& RenderingQueue::flushBuffer() {
     if (isEmpty()) {
         return *this;
     }
+
+    for (auto& buffer : m_deferredBuffers) {
+        addBufferToJava(*buffer);
+    }
+    m_deferredBuffers.clear();
+    m_deferredSize = 0;
+
+    if (m_buffer && !m_buffer->isEmpty()) {
+        addBufferToJava(*m_buffer);
+    }
+    m_buffer = nullptr;
+    ++m_flushedBufferCount;
+
+    return *this;
+}
+
+void RenderingQueue::addBufferToJava(ByteBuffer& buffer) {
     JNIEnv* env = WTF::GetJavaEnv();
 
     static jmethodID midFwkAddBuffer = env->GetMethodID(PG_GetRenderQueueClass(env),
@@ -110,16 +182,12 @@ RenderingQueue& RenderingQueue::flushBuffer() {
     ASSERT(midFwkAddBuffer);
 
     Addr2ByteBuffer &a2bb = getAddr2ByteBuffer();
-    a2bb.set(m_buffer->bufferAddress(), m_buffer);
+    a2bb.set(buffer.bufferAddress(), &buffer);
     env->CallVoidMethod(
         getWCRenderingQueue(),
         midFwkAddBuffer,
-        (jobject)(m_buffer->createDirectByteBuffer(env)));
+        (jobject)(buffer.createDirectByteBuffer(env)));
     WTF::CheckAndClearException(env);
-
-    m_buffer = nullptr;
-
-    return *this;
 }
 }
 
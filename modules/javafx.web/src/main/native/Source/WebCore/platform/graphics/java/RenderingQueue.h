@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2017, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -26,22 +26,64 @@
 #pragma once
 
 #include <jni.h>
+#include <span>
 #include <wtf/Vector.h>
 #include <wtf/RefCounted.h>
+#include <wtf/HashMap.h>
 #include <wtf/HashSet.h>
+#include <wtf/Lock.h>
+#include <wtf/NeverDestroyed.h>
+#include <wtf/Noncopyable.h>
 #include <wtf/java/DbgUtils.h>
 
 #include "RQRef.h"
+#include "com_sun_webkit_graphics_WCRenderQueue.h"
 
 namespace WebCore {
 
 class RQRef;
 
+/*
+ * Recycles the storage of ByteBuffers released by the Java side (see
+ * WCRenderQueue.twkRelease), so that steady repainting does not allocate a new
+ * chunk of memory for every buffer flushed to Java. Blocks are kept in free lists
+ * per power-of-two size class; the amount of idle memory held by the pool is
+ * bounded by MAX_POOLED_BYTES.
+ */
+class ByteBufferPool {
+    WTF_MAKE_NONCOPYABLE(ByteBufferPool);
+public:
+    static const size_t MAX_POOLED_BYTES = 0x200000;
+
+    static ByteBufferPool& singleton();
+
+    // Returns a block of at least [capacity] bytes; [capacity] is updated
+    // to the actual size of the block.
+    char* acquire(int& capacity);
+    void recycle(char* block, int capacity);
+
+    // Counters for profiling.
+    size_t buffersInFlight() const { return m_buffersInFlight; }
+    size_t bytesInFlight() const { return m_bytesInFlight; }
+    size_t bytesHeld() const { return m_bytesHeld; }
+
+private:
+    friend class NeverDestroyed<ByteBufferPool>;
+    ByteBufferPool() = default;
+
+    Lock m_lock;
+    HashMap<int, Vector<char*>> m_freeLists;
+    size_t m_buffersInFlight { 0 };
+    size_t m_bytesInFlight { 0 };
+    size_t m_bytesHeld { 0 };
+};
+
 class ByteBuffer : public RefCounted<ByteBuffer> {
     RQ_LOG_INSTANCE_COUNT(ByteBuffer)
 public:
     static RefPtr<ByteBuffer> create(int capacity) {
-        return adoptRef(new ByteBuffer(capacity));
+        char* buffer = ByteBufferPool::singleton().acquire(capacity);
+        return adoptRef(new ByteBuffer(buffer, capacity));
     }
 
     JLObject createDirectByteBuffer(JNIEnv* env) {
@@ -72,17 +114,25 @@ public:
         m_position += sizeof(jfloat);
     }
 
+    void putInts(std::span<const jint> data) {
+        ASSERT(m_position + data.size_bytes() <= static_cast<size_t>(m_capacity));
+        memcpy((m_buffer + m_position), data.data(), data.size_bytes());
+        m_position += data.size_bytes();
+    }
+
     bool hasFreeSpace(int size) { return m_position + size <= m_capacity; }
 
+    int size() const { return m_position; }
+
     bool isEmpty() { return m_position == 0; }
 
     ~ByteBuffer() {
-        delete[] m_buffer;
+        ByteBufferPool::singleton().recycle(m_buffer, m_capacity);
     }
 
 private:
-    ByteBuffer(int capacity) :
-        m_buffer(new char[capacity]),
+    ByteBuffer(char* buffer, int capacity) :
+        m_buffer(buffer),
         m_capacity(capacity),
         m_position(0)
     {}
@@ -103,11 +153,24 @@ private:
  * Also note that JavaScript may draw into canvas on the Event thread in time
  * other than WebPage::updateContent is called. Thus it may happen concurrently
  * with rendering (performed on the Render thread on the java side).
+ *
+ * An autoFlush RQ normally hands every full buffer to java and has it decoded
+ * right away. When deferring is enabled (see setDefersAutoFlush) full buffers
+ * are recorded natively instead, and handed over together when the image is
+ * used (flushBuffer) or when MAX_DEFERRED_SIZE bytes have piled up.
  */
 class RenderingQueue : public RefCounted<RenderingQueue> {
     RQ_LOG_INSTANCE_COUNT(RenderingQueue)
 public:
     static const size_t MAX_BUFFER_COUNT = 8;
+    static const size_t MAX_DEFERRED_SIZE = com_sun_webkit_graphics_WCRenderQueue_MAX_QUEUE_SIZE;
+
+    static void setDefersAutoFlush(bool defers) { s_defersAutoFlush = defers; }
+
+    // One of the GraphicsDecoder ENCODING_VERSION_* constants; commands
+    // introduced by a later version are not emitted.
+    static void setEncodingVersion(int version) { s_encodingVersion = version; }
+    static int encodingVersion() { return s_encodingVersion; }
 
     static RefPtr<RenderingQueue> create(
         const JLObject &jRQ,
@@ -131,13 +194,22 @@ public:
         return *this;
     }
 
+    RenderingQueue& operator << (std::span<const jint> data) {
+        m_buffer->putInts(data);
+        return *this;
+    }
+
     RenderingQueue& freeSpace(int size);
     RenderingQueue& flushBuffer();
 
     bool isEmpty() {
-        return m_buffer == nullptr || m_buffer->isEmpty();
+        return (m_buffer == nullptr || m_buffer->isEmpty()) && m_deferredBuffers.isEmpty();
     }
 
+    // Grows every time drawing commands are handed to Java, so that users of
+    // the queue can tell whether its target may have changed since then.
+    unsigned flushedBufferCount() const { return m_flushedBufferCount; }
+
     JLObject getWCRenderingQueue() {
         return m_rqoRenderingQueue->cloneLocalCopy();
     }
@@ -162,6 +234,10 @@ private:
 
     void flush();
     void disposeGraphics();
+    void addBufferToJava(ByteBuffer&);
+
+    static bool s_defersAutoFlush;
+    static int s_encodingVersion;
 
     //we need to have RQRef here due to [deref]
     //callback in destructor. Texture need to be released.
@@ -170,6 +246,9 @@ private:
     int m_capacity;
     bool m_autoFlush;
     RefPtr<ByteBuffer> m_buffer; // ref to the current ByteBuffer
+    Vector<RefPtr<ByteBuffer>> m_deferredBuffers; // full buffers not handed to java yet
+    size_t m_deferredSize { 0 };
+    unsigned m_flushedBufferCount { 0 };
 
 };
 } // namespace WebCore
@@ -37,6 +37,9 @@
 #include "GraphicsTypesGL.h"
 #include "Image.h"
 #include "TextureMapperFlags.h"
+#if PLATFORM(JAVA)
+#include "TextureMapperJava.h"
+#endif
 #include "TextureMapperShaderProgram.h"
 #include <wtf/HashMap.h>
 #include <wtf/MathExtras.h>
@@ -1596,7 +1599,12 @@ IntRect TextureMapper::clipBounds()
 
 IntSize TextureMapper::maxTextureSize() const
 {
+#if PLATFORM(JAVA)
+    // There is no GL limit to query, see TextureMapperJava::setTileSize().
+    return TextureMapperJava::tileSize();
+#else
     return IntSize(data().maxTextureSize(), data().maxTextureSize());
+#endif
 }
 
 void TextureMapper::setDepthRange(double zNear, double zFar)
@@ -58,6 +58,9 @@ public:
     const GraphicsLayerKeyframeValueList& keyframes() const { return m_keyframes; }
     State state() const { return m_state; }
     TimingFunction* timingFunction() const { return m_timingFunction.get(); }
+#if PLATFORM(JAVA)
+    Seconds duration() const { return Seconds(m_duration); }
+#endif
 
 private:
     void applyInternal(ApplicationResult&, const GraphicsLayerAnimationValue& from, const GraphicsLayerAnimationValue& to, float progress);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018, 2021, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2018, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -38,15 +38,26 @@ namespace WebCore {
 
 WTF_MAKE_TZONE_ALLOCATED_IMPL(TextureMapperJava);
 
-static const int s_maximumAllowedImageBufferDimension = 256;
+static const int s_defaultImageBufferDimension = 256;
+static const int s_minimumAllowedImageBufferDimension = 64;
+static const int s_maximumAllowedImageBufferDimension = 4096;
+
+static IntSize s_tileSize(s_defaultImageBufferDimension, s_defaultImageBufferDimension);
 
 TextureMapperJava::TextureMapperJava()
 {
 }
 
-IntSize TextureMapperJava::maxTextureSize() const
+IntSize TextureMapperJava::tileSize()
 {
-    return IntSize(s_maximumAllowedImageBufferDimension, s_maximumAllowedImageBufferDimension);
+    return s_tileSize;
+}
+
+void TextureMapperJava::setTileSize(const IntSize& size)
+{
+    s_tileSize = size.constrainedBetween(
+        IntSize(s_minimumAllowedImageBufferDimension, s_minimumAllowedImageBufferDimension),
+        IntSize(s_maximumAllowedImageBufferDimension, s_maximumAllowedImageBufferDimension));
 }
 
 void TextureMapperJava::beginClip(const TransformationMatrix& matrix, const FloatRoundedRect& rect)
@@ -61,26 +72,6 @@ void TextureMapperJava::beginClip(const TransformationMatrix& matrix, const Floa
     context->setCTM(previousTransform);
 }
 
-void TextureMapperJava::drawTexture(const BitmapTextureJava& texture, const FloatRect& targetRect, const TransformationMatrix& transform, float opacity, unsigned /* exposedEdges */)
-{
-    GraphicsContext* context = currentContext();
-    if (!context)
-        return;
-
-    const BitmapTextureJava& textureImageBuffer = texture;
-    ImageBuffer* image = textureImageBuffer.image();
-    context->save();
-    context->setAlpha(opacity);
-    context->platformContext()->rq().freeSpace(68)
-        << (jint)com_sun_webkit_graphics_GraphicsDecoder_SET_PERSPECTIVE_TRANSFORM
-        << (float)transform.m11() << (float)transform.m12() << (float)transform.m13() << (float)transform.m14()
-        << (float)transform.m21() << (float)transform.m22() << (float)transform.m23() << (float)transform.m24()
-        << (float)transform.m31() << (float)transform.m32() << (float)transform.m33() << (float)transform.m34()
-        << (float)transform.m41() << (float)transform.m42() << (float)transform.m43() << (float)transform.m44();
-    context->drawImageBuffer(*image, targetRect);
-    context->restore();
-}
-
 void TextureMapperJava::drawSolidColor(const FloatRect& rect, const TransformationMatrix& transform, const Color& color, bool)
 {
     GraphicsContext* context = currentContext();
@@ -88,6 +79,8 @@ void TextureMapperJava::drawSolidColor(const FloatRect& rect, const Transformati
         return;
 
     context->save();
+    // A clip set under the replaced transform is not the same clip any more.
+    context->platformContext()->invalidateState(&PlatformStateShadow::clipRect);
     context->platformContext()->rq().freeSpace(68)
         << (jint)com_sun_webkit_graphics_GraphicsDecoder_SET_PERSPECTIVE_TRANSFORM
         << (float)transform.m11() << (float)transform.m12() << (float)transform.m13() << (float)transform.m14()
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2018, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -25,7 +25,6 @@
 
 #pragma once
 
-#include "BitmapTextureJava.h"
 #include "ImageBuffer.h"
 #include "TextureMapper.h"
 #include "GraphicsContext.h"
@@ -40,22 +39,21 @@ public:
     // TextureMapper implementation
     void drawBorder(const Color&, float borderWidth, const FloatRect&, const TransformationMatrix&);
     void drawNumber(int number, const Color&, const FloatPoint&, const TransformationMatrix&);
-    void drawTexture(const BitmapTextureJava&, const FloatRect& targetRect, const TransformationMatrix&, float opacity, unsigned exposedEdges);
     void drawSolidColor(const FloatRect&, const TransformationMatrix&, const Color&, bool);
     void beginClip(const TransformationMatrix&, const FloatRoundedRect&);
-    void bindSurface(BitmapTextureJava* surface) { m_currentSurface = surface;}
     void endClip() { graphicsContext()->restore(); }
     IntRect clipBounds() { return currentContext()->clipBounds(); }
-    IntSize maxTextureSize() const;
-    Ref<BitmapTextureJava> createTexture() { return BitmapTextureJava::create(); }
-    BitmapTextureJava* currentSurface() { return m_currentSurface ? m_currentSurface.get() : nullptr; }
-    Ref<BitmapTextureJava> createTexture(GCGLint) { return createTexture(); }
+    IntSize maxTextureSize() const { return tileSize(); }
+    // Composited layers larger than this are painted in tiles of this size,
+    // see TextureMapper::maxTextureSize().
+    static IntSize tileSize();
+    static void setTileSize(const IntSize&);
     void setDepthRange(double zNear, double zFar);
     void clearColor(const Color&);
 
     inline GraphicsContext* currentContext()
     {
-        return m_currentSurface ? m_currentSurface->graphicsContext() : graphicsContext();
+        return graphicsContext();
     }
 
     static Ref<TextureMapperJava> create()
@@ -66,7 +64,6 @@ public:
     void setGraphicsContext(GraphicsContext* context) { m_context = context; }
     GraphicsContext* graphicsContext() { return m_context; }
 private:
-    RefPtr<BitmapTextureJava> m_currentSurface;
     GraphicsContext* m_context;
 };
 
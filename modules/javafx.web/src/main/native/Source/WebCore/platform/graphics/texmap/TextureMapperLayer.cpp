@@ -1485,6 +1485,96 @@ bool TextureMapperLayer::descendantsOrSelfHaveRunningAnimations() const
         });
 }
 
+#if PLATFORM(JAVA)
+// Samples taken per animation duration, see animatedBoundsIncludingDescendants().
+static constexpr unsigned animatedBoundsSampleCount = 32;
+
+FloatRect TextureMapperLayer::animatedBoundsIncludingDescendants(MonotonicTime time)
+{
+    TransformationMatrix parentTransform;
+    if (m_parent)
+        parentTransform = m_parent->m_layerTransforms.combinedForChildren;
+    else if (m_effectTarget)
+        parentTransform = m_effectTarget->m_layerTransforms.combined;
+
+    // Positions between the samples are not covered, the 32 samples keep
+    // the error of a full turn within 1% of its radius.
+    Seconds duration = longestRunningAnimationDuration();
+    unsigned sampleCount = duration ? animatedBoundsSampleCount : 0;
+    FloatRect bounds;
+    for (unsigned i = 0; i <= sampleCount; ++i)
+        uniteBoundsIncludingDescendantsAt(sampleCount ? time + duration * i / sampleCount : time, parentTransform, bounds);
+    return bounds;
+}
+
+Seconds TextureMapperLayer::longestRunningAnimationDuration() const
+{
+    Seconds duration;
+    for (auto& animation : m_animations.animations()) {
+        if (animation.state() == TextureMapperAnimation::State::Playing)
+            duration = std::max(duration, animation.duration());
+    }
+    for (auto* child : m_children)
+        duration = std::max(duration, child->longestRunningAnimationDuration());
+    return duration;
+}
+
+// Mirrors computeTransformsRecursive() with the transforms and filters the
+// animations have at the given time.
+void TextureMapperLayer::uniteBoundsIncludingDescendantsAt(MonotonicTime time, const TransformationMatrix& parentTransform, FloatRect& bounds)
+{
+    if (m_state.size.isEmpty() && m_state.masksToBounds)
+        return;
+
+    // Reflections are not followed.
+    if (m_state.replicaLayer) {
+        bounds = FloatRect::infiniteRect();
+        return;
+    }
+
+    TransformationMatrix localTransform = m_layerTransforms.localTransform;
+    FilterOperations filters = m_currentFilters;
+    if (m_animations.hasRunningAnimations()) {
+        TextureMapperAnimation::ApplicationResult applicationResults;
+        m_animations.apply(applicationResults, time, TextureMapperAnimation::KeepInternalState::Yes);
+        localTransform = applicationResults.transform.value_or(m_state.transform);
+        filters = applicationResults.filters.value_or(m_state.filters);
+    }
+
+    const float originX = m_state.anchorPoint.x() * m_state.size.width();
+    const float originY = m_state.anchorPoint.y() * m_state.size.height();
+
+    TransformationMatrix combined = parentTransform;
+    combined
+        .translate3d(originX + (m_state.pos.x() - m_state.boundsOrigin.x()), originY + (m_state.pos.y() - m_state.boundsOrigin.y()), m_state.anchorPoint.z())
+        .multiply(localTransform);
+
+    TransformationMatrix combinedForChildren = combined;
+    combined.translate3d(-originX, -originY, -m_state.anchorPoint.z());
+
+    if (!m_state.preserves3D)
+        combinedForChildren.flatten();
+    combinedForChildren.multiply(m_state.childrenTransform);
+    combinedForChildren.translate3d(-originX, -originY, -m_state.anchorPoint.z());
+
+    FloatRect subtreeBounds = combined.mapRect(layerRect());
+    // Descendants are clipped to the layer.
+    if (!m_state.masksToBounds && !m_state.maskLayer) {
+        for (auto* child : m_children)
+            child->uniteBoundsIncludingDescendantsAt(time, combinedForChildren, subtreeBounds);
+    }
+
+    // The filter applies to the subtree as a whole, its outsets are taken
+    // in surface units.
+    if (filters.hasOutsets()) {
+        auto outsets = filters.outsets();
+        subtreeBounds.move(-outsets.left(), -outsets.top());
+        subtreeBounds.expand(outsets.left() + outsets.right(), outsets.top() + outsets.bottom());
+    }
+    bounds.unite(subtreeBounds);
+}
+#endif
+
 bool TextureMapperLayer::applyAnimationsRecursively(MonotonicTime time)
 {
     bool hasRunningAnimations = syncAnimations(time);
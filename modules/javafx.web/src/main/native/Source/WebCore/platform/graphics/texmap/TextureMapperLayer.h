@@ -112,6 +112,14 @@ public:
     WEBCORE_EXPORT bool applyAnimationsRecursively(MonotonicTime);
     bool syncAnimations(MonotonicTime);
     WEBCORE_EXPORT bool descendantsOrSelfHaveRunningAnimations() const;
+#if PLATFORM(JAVA)
+    bool hasRunningAnimations() const { return m_animations.hasRunningAnimations(); }
+    // Bounds in surface coordinates that the layer and its descendants may
+    // cover from the given time on, while their running animations move,
+    // scale or filter them. The animations are sampled over the longest
+    // duration among them.
+    FloatRect animatedBoundsIncludingDescendants(MonotonicTime);
+#endif
 
     WEBCORE_EXPORT void prepareForPainting(TextureMapper&);
     WEBCORE_EXPORT void paint(TextureMapper&);
@@ -152,6 +160,10 @@ private:
 
     struct ComputeTransformData;
     void computeTransformsRecursive(ComputeTransformData&);
+#if PLATFORM(JAVA)
+    Seconds longestRunningAnimationDuration() const;
+    void uniteBoundsIncludingDescendantsAt(MonotonicTime, const TransformationMatrix& parentTransform, FloatRect&);
+#endif
 
     TransformationMatrix replicaTransform();
     void removeFromParent();
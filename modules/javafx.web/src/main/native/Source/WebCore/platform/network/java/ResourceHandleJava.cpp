@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -45,6 +45,8 @@ bool ResourceHandle::start()
 {
     ASSERT(!d->m_loader);
     d->m_loader = URLLoader::loadAsynchronously(context(), this, this->firstRequest());
+    if (d->m_loader && d->m_defersLoading)
+        d->m_loader->setDefersLoading(true);
     return d->m_loader != nullptr;
 }
 
@@ -149,6 +151,8 @@ void ResourceHandle::continueAfterWillSendRequest(ResourceRequest&& request)
         return;
     }
     d->m_loader = URLLoader::loadAsynchronously(context(), this, request);
+    if (d->m_loader && d->m_defersLoading)
+        d->m_loader->setDefersLoading(true);
 }
 
 //utatodo: merge artifact
@@ -164,9 +168,10 @@ void ResourceHandle::platformLoadResourceSynchronously(NetworkingContext* contex
     URLLoader::loadSynchronously(context, request, error, response, data);
 }
 
-void ResourceHandle::platformSetDefersLoading(bool)
+void ResourceHandle::platformSetDefersLoading(bool defers)
 {
-    notImplemented();
+    if (d->m_loader)
+        d->m_loader->setDefersLoading(defers);
 }
 
 void ResourceHandle::receivedCredential(const AuthenticationChallenge&, const Credential&)
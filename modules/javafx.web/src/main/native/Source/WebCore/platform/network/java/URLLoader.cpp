@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -29,6 +29,7 @@
 #pragma GCC diagnostic ignored "-Wunused-parameter"
 #endif
 
+#include "FormData.h"
 #include "FrameNetworkingContext.h"
 #include "HTTPParsers.h"
 #include "MIMETypeRegistry.h"
@@ -45,8 +46,11 @@
 #include "URLLoader.h"
 #include "NetworkLoadMetrics.h"
 #include "com_sun_webkit_LoadListenerClient.h"
+#include "com_sun_webkit_network_FormDataElement.h"
 #include "com_sun_webkit_network_URLLoaderBase.h"
 #include <wtf/CompletionHandler.h>
+#include <wtf/MainThread.h>
+#include <wtf/TZoneMallocInlines.h>
 
 namespace WebCore {
 class Page;
@@ -61,10 +65,14 @@ static jmethodID loadMethod;
 
 static JGClass urlLoaderClass;
 static jmethodID cancelMethod;
+static jmethodID setDefersLoadingMethod;
 
 static JGClass formDataElementClass;
 static jmethodID createFromFileMethod;
-static jmethodID createFromByteArrayMethod;
+static jmethodID createFromDirectBufferMethod;
+
+static JGClass byteBufferPoolClass;
+static jmethodID recycleMethod;
 
 static void initRefs(JNIEnv* env)
 {
@@ -76,7 +84,7 @@ static void initRefs(JNIEnv* env)
         loadMethod = env->GetStaticMethodID(
                 networkContextClass,
                 "fwkLoad",
-                "(Lcom/sun/webkit/WebPage;Z"
+                "(Lcom/sun/webkit/WebPage;ZI"
                 "Ljava/lang/String;Ljava/lang/String;Ljava/lang/String;"
                 "[Lcom/sun/webkit/network/FormDataElement;J)"
                 "Lcom/sun/webkit/network/URLLoaderBase;");
@@ -89,27 +97,90 @@ static void initRefs(JNIEnv* env)
 
         cancelMethod = env->GetMethodID(urlLoaderClass, "fwkCancel", "()V");
         ASSERT(cancelMethod);
+
+        setDefersLoadingMethod = env->GetMethodID(urlLoaderClass,
+                "fwkSetDefersLoading", "(Z)V");
+        ASSERT(setDefersLoadingMethod);
     }
     if (!formDataElementClass) {
         formDataElementClass = JLClass(env->FindClass(
                 "com/sun/webkit/network/FormDataElement"));
         ASSERT(formDataElementClass);
 
-        createFromByteArrayMethod = env->GetStaticMethodID(
+        createFromDirectBufferMethod = env->GetStaticMethodID(
                 formDataElementClass,
-                "fwkCreateFromByteArray",
-                "([B)Lcom/sun/webkit/network/FormDataElement;");
-        ASSERT(createFromByteArrayMethod);
+                "fwkCreateFromDirectBuffer",
+                "(Ljava/nio/ByteBuffer;J)"
+                "Lcom/sun/webkit/network/FormDataElement;");
+        ASSERT(createFromDirectBufferMethod);
 
         createFromFileMethod = env->GetStaticMethodID(
                 formDataElementClass,
                 "fwkCreateFromFile",
-                "(Ljava/lang/String;)"
+                "(Ljava/lang/String;JJ)"
                 "Lcom/sun/webkit/network/FormDataElement;");
         ASSERT(createFromFileMethod);
     }
+    if (!byteBufferPoolClass) {
+        byteBufferPoolClass = JLClass(env->FindClass(
+                "com/sun/webkit/network/ByteBufferPool"));
+        ASSERT(byteBufferPoolClass);
+
+        recycleMethod = env->GetMethodID(
+                byteBufferPoolClass,
+                "fwkRecycle",
+                "(Ljava/nio/ByteBuffer;)V");
+        ASSERT(recycleMethod);
+    }
 }
 
+static void recycleByteBuffer(jobject pool, jobject byteBuffer)
+{
+    JNIEnv* env = WTF::GetJavaEnv();
+    if (!env)
+        return;
+
+    env->CallVoidMethod(pool, recycleMethod, byteBuffer);
+    WTF::CheckAndClearException(env);
+    env->DeleteGlobalRef(byteBuffer);
+    env->DeleteGlobalRef(pool);
+}
+
+// A direct ByteBuffer lent by a ByteBufferPool to WebCore. The buffer backs
+// a SharedBuffer segment in place and goes back to the pool when the last
+// reference to that segment is dropped.
+class ByteBufferLease {
+    WTF_MAKE_TZONE_ALLOCATED_INLINE(ByteBufferLease);
+public:
+    ByteBufferLease(JNIEnv* env, jobject pool, jobject byteBuffer, std::span<const uint8_t> span)
+        : m_pool(env->NewGlobalRef(pool))
+        , m_byteBuffer(env->NewGlobalRef(byteBuffer))
+        , m_span(span)
+    {
+    }
+
+    ~ByteBufferLease()
+    {
+        // Segments may be released on threads that are not attached to the
+        // JVM, e.g. image decoders, in which case the pool is called back
+        // from the main thread.
+        if (WTF::GetJavaEnv()) {
+            recycleByteBuffer(m_pool, m_byteBuffer);
+            return;
+        }
+        callOnMainThread([pool = m_pool, byteBuffer = m_byteBuffer] {
+            recycleByteBuffer(pool, byteBuffer);
+        });
+    }
+
+    std::span<const uint8_t> span() const { return m_span; }
+
+private:
+    jobject m_pool;
+    jobject m_byteBuffer;
+    std::span<const uint8_t> m_span;
+};
+
 }
 
 URLLoader::URLLoader()
@@ -149,6 +220,18 @@ void URLLoader::cancel()
     }
 }
 
+void URLLoader::setDefersLoading(bool defers)
+{
+    using namespace URLLoaderJavaInternal;
+    if (m_ref) {
+        JNIEnv* env = WTF::GetJavaEnv();
+        initRefs(env);
+
+        env->CallVoidMethod(m_ref, setDefersLoadingMethod, bool_to_jbool(defers));
+        WTF::CheckAndClearException(env);
+    }
+}
+
 void URLLoader::loadSynchronously(NetworkingContext* context,
                                   const ResourceRequest& request,
                                   ResourceError& error,
@@ -198,6 +281,7 @@ JLObject URLLoader::load(bool asynchronous,
             loadMethod,
             (jobject) webPage,
             bool_to_jbool(asynchronous),
+            static_cast<jint>(request.priority()),
             (jstring) request.url().string().toJavaString(env),
             (jstring) request.httpMethod().toJavaString(env),
             (jstring) headerString.toJavaString(env),
@@ -208,14 +292,17 @@ JLObject URLLoader::load(bool asynchronous,
     return loader;
 }
 
-JLObjectArray URLLoader::toJava(const FormData* formData)
+JLObjectArray URLLoader::toJava(FormData* formData)
 {
     using namespace URLLoaderJavaInternal;
     if (!formData) {
         return nullptr;
     }
 
-    const Vector<FormDataElement>& elements = formData->elements();
+    // Blobs are resolved to the bytes and file ranges backing them, so that
+    // all elements can be streamed by the loader.
+    Ref<FormData> resolvedFormData = formData->resolveBlobReferences();
+    const Vector<FormDataElement>& elements = resolvedFormData->elements();
     size_t size = elements.size();
     if (size == 0) {
         return nullptr;
@@ -232,28 +319,33 @@ JLObjectArray URLLoader::toJava(const FormData* formData)
         JLObject resultElement;
         WTF::switchOn(elements[i].data,
             [&] (const Vector<uint8_t>& data) -> void {
-                JLByteArray byteArray = env->NewByteArray(data.size());
-                env->SetByteArrayRegion(
-                        (jbyteArray) byteArray,
-                        (jsize) 0,
-                        (jsize) data.size(),
-                        (const jbyte*) data.span().data());
+                // The loader reads the bytes in place, on demand, through a
+                // read-only view of the buffer. The form data is kept alive
+                // until the loader releases it, see FormDataElement.release().
+                JLObject byteBuffer;
+                jlong nativePointer = 0;
+                if (!data.isEmpty()) {
+                    byteBuffer = env->NewDirectByteBuffer(
+                            const_cast<uint8_t*>(data.span().data()),
+                            (jlong) data.size());
+                    nativePointer = ptr_to_jlong(&resolvedFormData.copyRef().leakRef());
+                }
                 resultElement = env->CallStaticObjectMethod(
                         formDataElementClass,
-                        createFromByteArrayMethod,
-                        (jbyteArray) byteArray);
+                        createFromDirectBufferMethod,
+                        (jobject) byteBuffer,
+                        nativePointer);
             },
             [&] (const FormDataElement::EncodedFileData& data) -> void {
                 resultElement = env->CallStaticObjectMethod(
                         formDataElementClass,
                         createFromFileMethod,
-                        (jstring) data.filename.toJavaString(env));
+                        (jstring) data.filename.toJavaString(env),
+                        (jlong) data.fileStart,
+                        (jlong) data.fileLength);
             },
-            [&] (const FormDataElement::EncodedBlobData& data) -> void {
-                resultElement = env->CallStaticObjectMethod(
-                        formDataElementClass,
-                        createFromFileMethod,
-                        (jstring) data.url.string().toJavaString(env));
+            [&] (const FormDataElement::EncodedBlobData&) -> void {
+                ASSERT_NOT_REACHED();
             }
         );
         env->SetObjectArrayElement(
@@ -500,17 +592,40 @@ JNIEXPORT void JNICALL Java_com_sun_webkit_network_URLLoaderBase_twkDidReceiveRe
 
 JNIEXPORT void JNICALL Java_com_sun_webkit_network_URLLoaderBase_twkDidReceiveData
   (JNIEnv* env, jclass, jobject byteBuffer, jint position, jint remaining,
-   jlong data)
+   jobject pool, jlong data)
 {
     using namespace WebCore;
+    using namespace URLLoaderJavaInternal;
     URLLoader::Target* target =
             static_cast<URLLoader::Target*>(jlong_to_ptr(data));
     ASSERT(target);
     const uint8_t* address =
             static_cast<const uint8_t*>(env->GetDirectBufferAddress(byteBuffer));
-    Ref<SharedBuffer> tmp_buf = SharedBuffer::create(std::span<const uint8_t>(address, remaining));
-    target->didReceiveData(tmp_buf->makeContiguous().ptr() + position, remaining);
-    //target->didReceiveData((SharedBuffer*)(address) + position, remaining);
+    std::span<const uint8_t> span(address + position, remaining);
+
+    // Buffers lent by a pool are handed to WebCore without copying.
+    if (pool) {
+        initRefs(env);
+        auto lease = makeUnique<ByteBufferLease>(env, pool, byteBuffer, span);
+        Ref<SharedBuffer> buffer = SharedBuffer::create(DataSegment::Provider {
+            [lease = WTF::move(lease)] { return lease->span(); }
+        });
+        target->didReceiveData(buffer.ptr(), remaining);
+        return;
+    }
+
+    Ref<SharedBuffer> buffer = SharedBuffer::create(span);
+    target->didReceiveData(buffer.ptr(), remaining);
+}
+
+JNIEXPORT void JNICALL Java_com_sun_webkit_network_FormDataElement_twkReleaseFormData
+  (JNIEnv*, jclass, jlong nativePointer)
+{
+    using namespace WebCore;
+    ASSERT(isMainThread());
+    FormData* formData = static_cast<FormData*>(jlong_to_ptr(nativePointer));
+    ASSERT(formData);
+    formData->deref();
 }
 
 JNIEXPORT void JNICALL Java_com_sun_webkit_network_URLLoaderBase_twkDidFinishLoading
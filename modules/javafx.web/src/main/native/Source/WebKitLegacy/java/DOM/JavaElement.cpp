@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2019, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -29,6 +29,7 @@
 #include <WebCore/DOMException.h>
 #include <WebCore/Attr.h>
 #include <WebCore/CSSStyleProperties.h>
+#include <WebCore/Document.h>
 #include <WebCore/Element.h>
 #include <WebCore/ElementInlines.h>
 #include <WebCore/EventListener.h>
@@ -40,15 +41,65 @@
 #include <WebCore/NodeList.h>
 #include <WebCore/ScrollIntoViewOptions.h>
 #include <WebCore/StyledElement.h>
+#include <WebCore/Text.h>
 
+#include <wtf/JSONValues.h>
 #include <wtf/RefPtr.h>
 #include <wtf/GetPtr.h>
 
 #include <WebCore/JavaDOMUtils.h>
+#include <WebCore/StringJava.h>
 #include <wtf/java/JavaEnv.h>
 
 using namespace WebCore;
 
+namespace {
+
+void updateLayoutForBatch(Element& element)
+{
+    // Same visibility options as Element::boundingClientRect(), so that the
+    // per-element geometry queries that follow find the layout clean.
+    Ref document = element.document();
+    document->updateLayoutIgnorePendingStylesheets({ LayoutOptions::TreatContentVisibilityHiddenAsVisible, LayoutOptions::TreatContentVisibilityAutoAsVisible });
+}
+
+Ref<JSON::Object> snapshotOf(Element& element)
+{
+    auto snapshot = JSON::Object::create();
+    snapshot->setString("tag"_s, element.tagName());
+
+    if (element.hasAttributes()) {
+        auto attributes = JSON::Object::create();
+        for (auto& attribute : element.attributes())
+            attributes->setString(attribute.name().toString(), attribute.value());
+        snapshot->setObject("attributes"_s, WTF::move(attributes));
+    }
+
+    FloatRect rect = element.boundingClientRect();
+    auto box = JSON::Array::create();
+    box->pushDouble(rect.x());
+    box->pushDouble(rect.y());
+    box->pushDouble(rect.width());
+    box->pushDouble(rect.height());
+    snapshot->setArray("rect"_s, WTF::move(box));
+
+    auto children = JSON::Array::create();
+    for (RefPtr child = element.firstChild(); child; child = child->nextSibling()) {
+        if (auto* childElement = dynamicDowncast<Element>(*child)) {
+            children->pushObject(snapshotOf(*childElement));
+        } else if (auto* text = dynamicDowncast<Text>(*child)) {
+            auto textSnapshot = JSON::Object::create();
+            textSnapshot->setString("text"_s, text->data());
+            children->pushObject(WTF::move(textSnapshot));
+        }
+    }
+    if (children->length())
+        snapshot->setArray("children"_s, WTF::move(children));
+    return snapshot;
+}
+
+} // namespace
+
 extern "C" {
 
 #define IMPL (static_cast<Element*>(jlong_to_ptr(peer)))
@@ -1392,4 +1443,27 @@ JNIEXPORT jlong JNICALL Java_com_sun_webkit_dom_ElementImpl_querySelectorAllImpl
 }
 
 
+// Batched queries
+JNIEXPORT jobjectArray JNICALL Java_com_sun_webkit_dom_ElementImpl_getAttributeNamesAndValuesImpl(JNIEnv* env, jclass, jlong peer)
+{
+    WebCore::JSMainThreadNullState state;
+    Vector<AtomString> namesAndValues;
+    if (IMPL->hasAttributes()) {
+        for (auto& attribute : IMPL->attributes()) {
+            namesAndValues.append(attribute.name().toAtomString());
+            namesAndValues.append(attribute.value());
+        }
+    }
+    return strVect2JArray(env, namesAndValues);
+}
+
+
+JNIEXPORT jstring JNICALL Java_com_sun_webkit_dom_ElementImpl_getSubtreeSnapshotImpl(JNIEnv* env, jclass, jlong peer)
+{
+    WebCore::JSMainThreadNullState state;
+    updateLayoutForBatch(*IMPL);
+    return JavaReturn<String>(env, snapshotOf(*IMPL)->toJSONString());
+}
+
+
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2019, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -26,6 +26,8 @@
 #undef IMPL
 
 
+#include <WebCore/Document.h>
+#include <WebCore/Element.h>
 #include <WebCore/Node.h>
 #include <WebCore/NodeList.h>
 #include <WebCore/JSExecState.h>
@@ -65,4 +67,38 @@ JNIEXPORT jlong JNICALL Java_com_sun_webkit_dom_NodeListImpl_itemImpl(JNIEnv* en
 }
 
 
+// Returns {x, y, width, height} of getBoundingClientRect() for every node of
+// the list, zeros for nodes which are not elements. Layout is brought up to
+// date once for the whole list instead of once per element.
+JNIEXPORT jdoubleArray JNICALL Java_com_sun_webkit_dom_NodeListImpl_getBoundingClientRectsImpl(JNIEnv* env, jclass, jlong peer)
+{
+    WebCore::JSMainThreadNullState state;
+    unsigned length = IMPL->length();
+    Vector<double> boxes(4 * length, 0);
+    RefPtr<Document> updatedDocument;
+    for (unsigned i = 0; i < length; ++i) {
+        RefPtr element = dynamicDowncast<Element>(IMPL->item(i));
+        if (!element)
+            continue;
+        Ref document = element->document();
+        if (updatedDocument != document.ptr()) {
+            document->updateLayoutIgnorePendingStylesheets({ LayoutOptions::TreatContentVisibilityHiddenAsVisible, LayoutOptions::TreatContentVisibilityAutoAsVisible });
+            updatedDocument = WTF::move(document);
+        }
+        // The layout is clean at this point, so this only maps the box.
+        FloatRect rect = element->boundingClientRect();
+        boxes[4 * i] = rect.x();
+        boxes[4 * i + 1] = rect.y();
+        boxes[4 * i + 2] = rect.width();
+        boxes[4 * i + 3] = rect.height();
+    }
+
+    jdoubleArray result = env->NewDoubleArray(boxes.size());
+    if (WTF::CheckAndClearException(env)) // OOME
+        return nullptr;
+    env->SetDoubleArrayRegion(result, 0, boxes.size(), boxes.data());
+    return result;
+}
+
+
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -31,6 +31,7 @@
 #include <JavaScriptCore/APICast.h>
 #include <JavaScriptCore/JavaScript.h>
 #include <WebCore/AuthenticationChallenge.h>
+#include <WebCore/BytecodeCacheJava.h>
 #include <WebCore/Chrome.h>
 #include <WebCore/DNS.h>
 #include <WebCore/DocumentLoader.h>
@@ -798,6 +799,12 @@ void FrameLoaderClientJava::dispatchDidFinishLoading(DocumentLoader* l, Resource
 
 void FrameLoaderClientJava::dispatchDidFinishLoad()
 {
+    if (frame()->isMainFrame()) {
+        // The scripts of the page have run by now, write out their bytecode
+        // instead of waiting for them to be collected.
+        BytecodeCacheJava::commitPendingUpdates();
+    }
+
     double progress = page()->progress().estimatedProgress();
     auto* localFrame = dynamicDowncast<LocalFrame>(frame());
     postLoadEvent(frame(),
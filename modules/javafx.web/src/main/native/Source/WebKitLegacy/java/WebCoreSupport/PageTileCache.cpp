@@ -0,0 +1,232 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "PageTileCache.h"
+
+#include <WebCore/GraphicsContext.h>
+#include <WebCore/LocalFrameView.h>
+#include <WebCore/PlatformContextJava.h>
+#include <wtf/HashSet.h>
+#include <wtf/NeverDestroyed.h>
+
+#include "com_sun_webkit_TileCache.h"
+#include "com_sun_webkit_graphics_GraphicsDecoder.h"
+
+namespace WebCore {
+
+static constexpr size_t tileBytes = PageTileCache::tileSize * PageTileCache::tileSize * 4;
+
+static size_t s_capacity = 32 * MB;
+
+// Number of tiles held by all caches.
+static size_t s_tileCount = 0;
+// Incremented by every paint, tiles record the value they were last used at.
+static unsigned s_paintCount = 0;
+
+static HashSet<PageTileCache*>& allCaches()
+{
+    static NeverDestroyed<HashSet<PageTileCache*>> caches;
+    return caches;
+}
+
+size_t PageTileCache::capacity()
+{
+    return s_capacity;
+}
+
+void PageTileCache::setCapacity(size_t bytes)
+{
+    s_capacity = bytes;
+}
+
+static int tileIndex(int coordinate)
+{
+    // Round towards negative infinity so that tiles never straddle zero.
+    return coordinate >= 0
+        ? coordinate / PageTileCache::tileSize
+        : (coordinate + 1) / PageTileCache::tileSize - 1;
+}
+
+IntRect PageTileCache::tileRect(const IntPoint& index)
+{
+    return IntRect(index.x() * tileSize, index.y() * tileSize, tileSize, tileSize);
+}
+
+PageTileCache::PageTileCache()
+{
+    allCaches().add(this);
+}
+
+PageTileCache::~PageTileCache()
+{
+    clear();
+    allCaches().remove(this);
+}
+
+void PageTileCache::invalidate(const IntRect& contentRect)
+{
+    if (contentRect.isEmpty())
+        return;
+
+    for (auto& [index, tile] : m_tiles) {
+        IntRect dirtyRect = intersection(tileRect(index), contentRect);
+        if (!dirtyRect.isEmpty())
+            tile.dirtyRect.unite(dirtyRect);
+    }
+}
+
+void PageTileCache::clear()
+{
+    s_tileCount -= m_tiles.size();
+    m_tiles.clear();
+    m_usageOrder.clear();
+}
+
+void PageTileCache::setFontSmoothingType(int fontSmoothingType)
+{
+    if (fontSmoothingType == m_fontSmoothingType)
+        return;
+
+    m_fontSmoothingType = fontSmoothingType;
+    clear();
+}
+
+PageTileCache::Tile* PageTileCache::ensureTile(const IntPoint& index)
+{
+    auto it = m_tiles.find(index);
+    if (it == m_tiles.end()) {
+        ImageBufferFormat format {
+            PixelFormat::BGRA8,
+            UseLosslessCompression::No
+        };
+        auto buffer = ImageBuffer::create(FloatSize(tileSize, tileSize), RenderingMode::Unaccelerated, RenderingPurpose::Unspecified, 1, DestinationColorSpace::SRGB(), format);
+        if (!buffer)
+            return nullptr;
+        it = m_tiles.add(index, Tile { WTF::move(buffer), tileRect(index) }).iterator;
+        ++s_tileCount;
+    }
+
+    it->value.lastUsed = s_paintCount;
+    m_usageOrder.appendOrMoveToLast(index);
+    return &it->value;
+}
+
+void PageTileCache::removeTile(const IntPoint& index)
+{
+    m_usageOrder.remove(index);
+    if (m_tiles.remove(index))
+        --s_tileCount;
+}
+
+void PageTileCache::evictTiles()
+{
+    size_t maxTiles = s_capacity / tileBytes;
+    while (s_tileCount > maxTiles) {
+        PageTileCache* leastRecentlyUsedCache = nullptr;
+        unsigned leastRecentUse = 0;
+        for (auto* cache : allCaches()) {
+            if (cache->m_usageOrder.isEmpty())
+                continue;
+            unsigned lastUsed = cache->m_tiles.find(cache->m_usageOrder.first())->value.lastUsed;
+            if (!leastRecentlyUsedCache || lastUsed < leastRecentUse) {
+                leastRecentlyUsedCache = cache;
+                leastRecentUse = lastUsed;
+            }
+        }
+        // Tiles drawn by the current paint stay, even above the capacity.
+        if (!leastRecentlyUsedCache || leastRecentUse == s_paintCount)
+            break;
+        leastRecentlyUsedCache->removeTile(leastRecentlyUsedCache->m_usageOrder.first());
+    }
+}
+
+void PageTileCache::paint(GraphicsContext& context, LocalFrameView& frameView, const IntRect& contentRect)
+{
+    if (contentRect.isEmpty())
+        return;
+
+    ++s_paintCount;
+
+    int firstColumn = tileIndex(contentRect.x());
+    int lastColumn = tileIndex(contentRect.maxX() - 1);
+    int firstRow = tileIndex(contentRect.y());
+    int lastRow = tileIndex(contentRect.maxY() - 1);
+
+    for (int row = firstRow; row <= lastRow; ++row) {
+        for (int column = firstColumn; column <= lastColumn; ++column) {
+            IntPoint index(column, row);
+            IntRect rect = tileRect(index);
+            IntRect visibleRect = intersection(rect, contentRect);
+
+            Tile* tile = ensureTile(index);
+            if (!tile) {
+                // No memory for the tile, paint into the context directly.
+                GraphicsContextStateSaver stateSaver(context);
+                context.clip(visibleRect);
+                frameView.paintContents(context, visibleRect);
+                continue;
+            }
+
+            if (!tile->dirtyRect.isEmpty()) {
+                GraphicsContext& tileContext = tile->buffer->context();
+                GraphicsContextStateSaver stateSaver(tileContext);
+                tileContext.translate(-rect.x(), -rect.y());
+                tileContext.clip(tile->dirtyRect);
+                // The tile is decoded on its own, possibly before the page.
+                tileContext.platformContext()->rq().freeSpace(8)
+                << (jint)com_sun_webkit_graphics_GraphicsDecoder_SET_FONT_SMOOTHING_TYPE
+                << (jint)m_fontSmoothingType;
+                tileContext.clearRect(tile->dirtyRect);
+                frameView.paintContents(tileContext, tile->dirtyRect);
+                tile->dirtyRect = { };
+            }
+
+            FloatRect sourceRect(visibleRect);
+            sourceRect.moveBy(-rect.location());
+            context.drawImageBuffer(*tile->buffer, visibleRect, sourceRect);
+        }
+    }
+
+    evictTiles();
+}
+
+} // namespace WebCore
+
+extern "C" {
+
+JNIEXPORT jlong JNICALL Java_com_sun_webkit_TileCache_twkGetCapacity
+  (JNIEnv *, jclass)
+{
+    return WebCore::PageTileCache::capacity();
+}
+
+JNIEXPORT void JNICALL Java_com_sun_webkit_TileCache_twkSetCapacity
+  (JNIEnv *, jclass, jlong capacity)
+{
+    ASSERT(capacity >= 0);
+    WebCore::PageTileCache::setCapacity(capacity);
+}
+
+}
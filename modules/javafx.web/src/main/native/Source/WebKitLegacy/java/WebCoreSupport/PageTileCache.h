@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#pragma once
+
+#include <WebCore/ImageBuffer.h>
+#include <WebCore/IntPointHash.h>
+#include <WebCore/IntRect.h>
+#include <wtf/HashMap.h>
+#include <wtf/ListHashSet.h>
+
+namespace WebCore {
+
+class GraphicsContext;
+class LocalFrameView;
+
+// Keeps the rasterized contents of the main frame in fixed size tiles keyed
+// by their position in content coordinates, so that areas scrolled back into
+// view are drawn from the tiles instead of being painted again. Tiles are
+// repainted only where they have been invalidated; the least recently used
+// ones of all pages are evicted once the caches grow beyond their capacity.
+class PageTileCache {
+    WTF_MAKE_NONCOPYABLE(PageTileCache);
+public:
+    static constexpr int tileSize = 256;
+
+    // The capacity, in bytes, is shared by the caches of all pages. Zero
+    // disables the cache.
+    static size_t capacity();
+    static void setCapacity(size_t bytes);
+
+    PageTileCache();
+    ~PageTileCache();
+
+    void invalidate(const IntRect& contentRect);
+    void clear();
+
+    // The font smoothing type the page is drawn with (see
+    // WCGraphicsContext.setFontSmoothingType), which the tiles keep.
+    void setFontSmoothingType(int);
+
+    // Draws the given area of the frame contents into the context, whose
+    // transform maps content coordinates.
+    void paint(GraphicsContext&, LocalFrameView&, const IntRect& contentRect);
+
+private:
+    struct Tile {
+        RefPtr<ImageBuffer> buffer;
+        IntRect dirtyRect;
+        unsigned lastUsed { 0 };
+    };
+
+    static IntRect tileRect(const IntPoint& index);
+    Tile* ensureTile(const IntPoint& index);
+    void removeTile(const IntPoint& index);
+    static void evictTiles();
+
+    HashMap<IntPoint, Tile> m_tiles;
+    ListHashSet<IntPoint> m_usageOrder;
+    int m_fontSmoothingType { 0 };
+};
+
+} // namespace WebCore
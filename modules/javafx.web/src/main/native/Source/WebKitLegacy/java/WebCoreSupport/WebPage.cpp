@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -56,6 +56,8 @@
 #include <JavaScriptCore/Options.h>
 #include <WebCore/BackForwardController.h>
 #include <WebCore/BridgeUtils.h>
+#include <WebCore/JavaClassJSC.h>
+#include <WebCore/BytecodeCacheJava.h>
 #include <WebCore/CharacterData.h>
 #include <WebCore/Chrome.h>
 #include <WebCore/ColorTypes.h>
@@ -81,9 +83,12 @@
 #include <WebCore/GeolocationClientMock.h>
 #include <WebCore/GraphicsContext.h>
 #include <WebCore/GraphicsLayerTextureMapper.h>
+#include <WebCore/HTMLCanvasElement.h>
+#include <WebCore/ImageBuffer.h>
 #include <WebCore/PageInspectorController.h>
 #include <WebCore/KeyboardEvent.h>
 #include <WebCore/LogInitialization.h>
+#include <WebCore/MemoryCache.h>
 #include <WebCore/NodeTraversal.h>
 #include <WebCore/Page.h>
 #include <WebCore/PageConfiguration.h>
@@ -107,6 +112,10 @@
 #include <WebCore/TextureMapperLayer.h>
 #include <WebCore/WorkerThread.h>
 #include <WebCore/platform/graphics/java/GraphicsContextJava.h>
+#include <wtf/FileHandle.h>
+#include <wtf/FileSystem.h>
+#include <wtf/MainThread.h>
+#include <wtf/MappedFileData.h>
 #include <wtf/Ref.h>
 #include <wtf/RunLoop.h>
 #include <wtf/java/JavaRef.h>
@@ -133,6 +142,7 @@
 #include "com_sun_webkit_event_WCFocusEvent.h"
 #include "com_sun_webkit_event_WCKeyEvent.h"
 #include "com_sun_webkit_event_WCMouseEvent.h"
+#include "com_sun_webkit_graphics_GraphicsDecoder.h"
 
 #if ENABLE(NOTIFICATIONS) || ENABLE(LEGACY_NOTIFICATIONS)
 #include <WebCore/NotificationController.h>
@@ -193,6 +203,7 @@ void WebPage::setSize(const IntSize& size)
 
     frameView->resize(size);
     frameView->layoutContext().scheduleLayout();
+    m_tileCache.clear();
 
     if (m_rootLayer) {
         m_rootLayer->setSize(size);
@@ -239,6 +250,7 @@ void WebPage::prePaint() {
     }
 
    if(!m_page) return;
+   flushPendingRepaints();
    auto* localFrame = dynamicDowncast<LocalFrame>(&m_page->mainFrame());
    if (!localFrame)
        return;
@@ -280,12 +292,72 @@ void WebPage::paint(jobject rq, jint x, jint y, jint w, jint h)
     JSGlobalContextRef globalContext = toGlobalRef(localFrame->script().globalObject(mainThreadNormalWorldSingleton()));
     JSC::JSLockHolder sw(toJS(globalContext)); // TODO-java: was JSC::APIEntryShim sw( toJS(globalContext) );
 
-    frameView->paint(gc, IntRect(x, y, w, h));
+    if (updateTileCacheState(*frameView))
+        paintWithTileCache(gc, *frameView, IntRect(x, y, w, h));
+    else
+        frameView->paint(gc, IntRect(x, y, w, h));
     if (m_page->settings().showDebugBorders()) {
         drawDebugLed(gc, IntRect(x, y, w, h), SRGBA<uint8_t> { 0, 0, 255, 128 });
     }
 
-    gc.platformContext()->rq().flushBuffer();
+    gc.platformContext()->queue().flushBuffer();
+    m_lastPaintElidedCommandCount = gc.platformContext()->elidedCommandCount();
+}
+
+static LocalFrameView* mainFrameView(Page& page)
+{
+    auto* localFrame = dynamicDowncast<LocalFrame>(&page.mainFrame());
+    return localFrame ? localFrame->view() : nullptr;
+}
+
+// Tiles keep the contents outside of the visible area, so the main frame has
+// to report repaints all over its contents, which is what paintsEntireContents
+// makes it do. Whatever is painted at a position that depends on the scroll
+// position cannot be cached by content coordinates.
+bool WebPage::updateTileCacheState(LocalFrameView& frameView)
+{
+    bool useTileCache = !m_rootLayer
+        && PageTileCache::capacity()
+        && m_page->deviceScaleFactor() == 1
+        && !frameView.platformWidget()
+        && frameView.canBlitOnScroll()
+        && !frameView.hasViewportConstrainedObjects();
+
+    // A new frame view starts without paintsEntireContents, and one that had
+    // it turned off has dropped the repaints outside of its visible area.
+    if (useTileCache != frameView.paintsEntireContents()) {
+        m_tileCache.clear();
+        frameView.setPaintsEntireContents(useTileCache);
+    }
+    return useTileCache;
+}
+
+// Same as ScrollView::paint(), with the contents drawn from the tile cache.
+void WebPage::paintWithTileCache(GraphicsContext& gc, LocalFrameView& frameView, const IntRect& rect)
+{
+    IntRect visibleContentRect = frameView.visibleContentRect();
+    IntRect contentRect = intersection(rect, IntRect(frameView.locationOfContents(), visibleContentRect.size()));
+    if (!contentRect.isEmpty()) {
+        GraphicsContextStateSaver stateSaver(gc);
+        IntPoint contentsOrigin = frameView.locationOfContents() - toIntSize(frameView.scrollPosition());
+        gc.translate(contentsOrigin.x(), contentsOrigin.y());
+        contentRect.moveBy(-contentsOrigin);
+        gc.clip(visibleContentRect);
+        m_tileCache.paint(gc, frameView, contentRect);
+    }
+    m_tileCacheScrollPosition = frameView.scrollPosition();
+
+    frameView.calculateAndPaintOverhangAreas(gc, rect);
+
+    if (!frameView.scrollbarsSuppressed() && (frameView.horizontalScrollbar() || frameView.verticalScrollbar())) {
+        GraphicsContextStateSaver stateSaver(gc);
+        IntRect visibleAreaWithScrollbars(frameView.location(), frameView.unobscuredContentRectIncludingScrollbars().size());
+        IntRect scrollViewDirtyRect = intersection(rect, visibleAreaWithScrollbars);
+        gc.translate(frameView.x(), frameView.y());
+        scrollViewDirtyRect.moveBy(-frameView.location());
+        gc.clip(IntRect(IntPoint(), visibleAreaWithScrollbars.size()));
+        frameView.paintScrollbars(gc, scrollViewDirtyRect);
+    }
 }
 
 void WebPage::postPaint(jobject rq, jint x, jint y, jint w, jint h)
@@ -309,8 +381,13 @@ void WebPage::postPaint(jobject rq, jint x, jint y, jint w, jint h)
         if (m_page->settings().showDebugBorders()) {
             drawDebugLed(gc, IntRect(x, y, w, h), SRGBA<uint8_t> { 0, 192, 0, 128 });
         }
-        if (downcast<GraphicsLayerTextureMapper>(m_rootLayer.get())->layer().descendantsOrSelfHaveRunningAnimations()) {
-            requestJavaRepaint(pageRect());
+        auto& rootTextureMapperLayer = downcast<GraphicsLayerTextureMapper>(m_rootLayer.get())->layer();
+        if (rootTextureMapperLayer.descendantsOrSelfHaveRunningAnimations()) {
+            m_lastAnimatedLayersDirtyRect = animatedLayersDirtyRect(rootTextureMapperLayer);
+            requestJavaRepaint(m_lastAnimatedLayersDirtyRect);
+        } else {
+            m_animatedLayerBounds.clear();
+            m_lastAnimatedLayersDirtyRect = { };
         }
     }
 
@@ -318,7 +395,7 @@ void WebPage::postPaint(jobject rq, jint x, jint y, jint w, jint h)
         m_page->inspectorController().drawHighlight(gc);
     }
 
-    gc.platformContext()->rq().flushBuffer();
+    gc.platformContext()->queue().flushBuffer();
 }
 
 void WebPage::scroll(const IntSize& scrollDelta,
@@ -330,6 +407,20 @@ void WebPage::scroll(const IntSize& scrollDelta,
         return;
     }
 
+    // Scrolling the main frame leaves the tiles valid as they are keyed by
+    // its content coordinates, but a subframe has scrolled its contents
+    // underneath them.
+    auto* frameView = mainFrameView(*m_page);
+    if (frameView && frameView->paintsEntireContents()) {
+        if (frameView->scrollPosition() == m_tileCacheScrollPosition)
+            m_tileCache.invalidate(frameView->rootViewToContents(rectToScroll));
+        m_tileCacheScrollPosition = frameView->scrollPosition();
+    }
+
+    // Java shifts the dirty rects it knows about by the scroll delta, so
+    // the ones requested before the scroll have to get there first.
+    flushPendingRepaints();
+
     JNIEnv* env = WTF::GetJavaEnv();
 
     static jmethodID mid = env->GetMethodID(
@@ -350,31 +441,92 @@ void WebPage::scroll(const IntSize& scrollDelta,
     WTF::CheckAndClearException(env);
 }
 
+void WebPage::setFontSmoothingType(int fontSmoothingType)
+{
+    // Tiles painted with another type are dropped.
+    m_tileCache.setFontSmoothingType(fontSmoothingType);
+}
+
 void WebPage::repaint(const IntRect& rect)
 {
     if (m_rootLayer) {
         m_rootLayer->setNeedsDisplayInRect(rect);
     }
+
+    // With the tile cache the repaints are not limited to the visible area.
+    auto* frameView = mainFrameView(*m_page);
+    if (frameView && frameView->paintsEntireContents()) {
+        m_tileCache.invalidate(frameView->rootViewToContents(rect));
+        requestJavaRepaint(intersection(rect, pageRect()));
+        return;
+    }
     requestJavaRepaint(rect);
 }
 
 void WebPage::requestJavaRepaint(const IntRect& rect)
 {
+    if (rect.isEmpty())
+        return;
+
+    // The rects are passed through as they are, Java merges them into its
+    // dirty rects (see WebPage.addDirtyRect()).
+    bool wasEmpty = m_pendingRepaintRects.isEmpty();
+    m_pendingRepaintRects.append(rect);
+    if (wasEmpty) {
+        callOnMainThread([weakThis = WeakPtr { *this }] {
+            if (weakThis)
+                weakThis->flushPendingRepaints();
+        });
+    }
+}
+
+void WebPage::flushPendingRepaints()
+{
+    if (m_pendingRepaintRects.isEmpty())
+        return;
+
+    auto rects = std::exchange(m_pendingRepaintRects, { });
+
     JNIEnv* env = WTF::GetJavaEnv();
 
+    if (rects.size() == 1) {
+        static jmethodID mid = env->GetMethodID(
+                PG_GetWebPageClass(env),
+                "fwkRepaint",
+                "(IIII)V");
+        ASSERT(mid);
+
+        env->CallVoidMethod(
+                jobjectFromPage(m_page.get()),
+                mid,
+                rects[0].x(),
+                rects[0].y(),
+                rects[0].width(),
+                rects[0].height());
+        WTF::CheckAndClearException(env);
+        return;
+    }
+
+    Vector<jint> packedRects;
+    packedRects.reserveInitialCapacity(rects.size() * 4);
+    for (auto& rect : rects)
+        packedRects.appendList({ rect.x(), rect.y(), rect.width(), rect.height() });
+
+    JLocalRef<jintArray> jRects(env->NewIntArray(packedRects.size()));
+    if (!jRects || WTF::CheckAndClearException(env))
+        return;
+    env->SetIntArrayRegion(jRects, 0, packedRects.size(), packedRects.span().data());
+
     static jmethodID mid = env->GetMethodID(
             PG_GetWebPageClass(env),
-            "fwkRepaint",
-            "(IIII)V");
+            "fwkRepaintRects",
+            "([I)V");
     ASSERT(mid);
 
     env->CallVoidMethod(
             jobjectFromPage(m_page.get()),
             mid,
-            rect.x(),
-            rect.y(),
-            rect.width(),
-            rect.height());
+            (jintArray)jRects);
     WTF::CheckAndClearException(env);
 }
 
@@ -392,7 +544,13 @@ void WebPage::setRootChildLayer(GraphicsLayer* layer)
     } else {
         m_rootLayer = nullptr;
         m_textureMapper.reset();
+        m_animatedLayerBounds.clear();
     }
+
+    // Composited painting goes through ScrollView::paint(), which relies on
+    // paintsEntireContents being off for the main frame.
+    if (auto* frameView = mainFrameView(*m_page))
+        updateTileCacheState(*frameView);
 }
 
 void WebPage::setNeedsOneShotDrawingSynchronization()
@@ -462,6 +620,45 @@ void WebPage::renderCompositedLayers(GraphicsContext& context, const IntRect& cl
     m_textureMapper->endPainting();
 }
 
+static void collectAnimatedLayerBounds(TextureMapperLayer& layer, MonotonicTime time, Vector<FloatRect>& animatedLayerBounds)
+{
+    if (!layer.descendantsOrSelfHaveRunningAnimations())
+        return;
+
+    // The subtree of an animated layer moves with it, so it is covered as a
+    // whole, including the animations of its descendants. The next frame is
+    // composited with the animations applied at the time it is painted, so
+    // the bounds cover the whole extent of the animations.
+    if (layer.hasRunningAnimations()) {
+        animatedLayerBounds.append(layer.animatedBoundsIncludingDescendants(time));
+        return;
+    }
+    for (auto* child : layer.children())
+        collectAnimatedLayerBounds(*child, time, animatedLayerBounds);
+}
+
+// Returns the part of the page the next animation frame has to repaint: where
+// the animated layers are now, and where they were in the previous frame.
+IntRect WebPage::animatedLayersDirtyRect(TextureMapperLayer& rootLayer)
+{
+    Vector<FloatRect> animatedLayerBounds;
+    collectAnimatedLayerBounds(rootLayer, MonotonicTime::now(), animatedLayerBounds);
+
+    FloatRect dirtyRect;
+    for (auto& bounds : animatedLayerBounds)
+        dirtyRect.unite(bounds);
+    for (auto& bounds : m_animatedLayerBounds)
+        dirtyRect.unite(bounds);
+    m_animatedLayerBounds = WTF::move(animatedLayerBounds);
+
+    // Painting is what drives the animations, so the page is still repainted
+    // as a whole while all of them are out of view.
+    dirtyRect.intersect(pageRect());
+    if (dirtyRect.isEmpty())
+        return pageRect();
+    return enclosingIntRect(dirtyRect);
+}
+
 void WebPage::notifyAnimationStarted(const GraphicsLayer*, const String& /*animationKey*/, MonotonicTime /*time*/)
 {
     ASSERT_NOT_REACHED();
@@ -779,7 +976,7 @@ void WebPage::print(GraphicsContext& gc, int pageIndex, float pageWidth)
     gc.translate(0, 0);
     m_printContext->spoolPage(gc, pageIndex, pageWidth);
     gc.restore();
-    gc.platformContext()->rq().flushBuffer();
+    gc.platformContext()->queue().flushBuffer();
 }
 
 int WebPage::globalDebugSessionCounter = 0;
@@ -891,6 +1088,120 @@ JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkInitWebCore
     s_useCSS3D = useCSS3D;
 }
 
+JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkSetLayerTileSize
+    (JNIEnv*, jclass, jint size)
+{
+    TextureMapperJava::setTileSize(IntSize(size, size));
+}
+
+JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkSetDefersCanvasDrawing
+    (JNIEnv*, jclass, jboolean defers)
+{
+    RenderingQueue::setDefersAutoFlush(jbool_to_bool(defers));
+}
+
+JNIEXPORT jint JNICALL Java_com_sun_webkit_WebPage_twkGetCachedJavaClassCount
+    (JNIEnv* env, jclass, jstring className)
+{
+    return JSC::Bindings::JavaClass::cachedClassCount(String(env, className));
+}
+
+JNIEXPORT jobjectArray JNICALL Java_com_sun_webkit_WebPage_twkListDirectory
+    (JNIEnv* env, jclass, jstring path)
+{
+    auto fileNames = FileSystem::listDirectory(String(env, path));
+    jobjectArray result = env->NewObjectArray(fileNames.size(),
+        JLClass(env->FindClass("java/lang/String")), nullptr);
+    if (!result || WTF::CheckAndClearException(env))
+        return nullptr;
+    for (size_t i = 0; i < fileNames.size(); ++i)
+        env->SetObjectArrayElement(result, i, (jstring)fileNames[i].toJavaString(env));
+    return result;
+}
+
+JNIEXPORT jboolean JNICALL Java_com_sun_webkit_WebPage_twkDeleteNonEmptyDirectory
+    (JNIEnv* env, jclass, jstring path)
+{
+    return bool_to_jbool(FileSystem::deleteNonEmptyDirectory(String(env, path)));
+}
+
+JNIEXPORT jboolean JNICALL Java_com_sun_webkit_WebPage_twkMoveFile
+    (JNIEnv* env, jclass, jstring oldPath, jstring newPath)
+{
+    return bool_to_jbool(FileSystem::moveFile(String(env, oldPath), String(env, newPath)));
+}
+
+JNIEXPORT jboolean JNICALL Java_com_sun_webkit_WebPage_twkCopyFile
+    (JNIEnv* env, jclass, jstring targetPath, jstring sourcePath)
+{
+    return bool_to_jbool(FileSystem::copyFile(String(env, targetPath), String(env, sourcePath)));
+}
+
+JNIEXPORT jboolean JNICALL Java_com_sun_webkit_WebPage_twkHardLinkOrCopyFile
+    (JNIEnv* env, jclass, jstring targetPath, jstring linkPath)
+{
+    return bool_to_jbool(FileSystem::hardLinkOrCopyFile(String(env, targetPath), String(env, linkPath)));
+}
+
+JNIEXPORT jbyteArray JNICALL Java_com_sun_webkit_WebPage_twkMapFile
+    (JNIEnv* env, jclass, jstring path)
+{
+    auto handle = FileSystem::openFile(String(env, path), FileSystem::FileOpenMode::Read);
+    if (!handle)
+        return nullptr;
+    auto mappedFile = handle.map(FileSystem::MappedFileMode::Private);
+    if (!mappedFile)
+        return nullptr;
+
+    auto data = mappedFile->span();
+    jbyteArray result = env->NewByteArray(data.size());
+    if (!result || WTF::CheckAndClearException(env))
+        return nullptr;
+    env->SetByteArrayRegion(result, 0, data.size(), reinterpret_cast<const jbyte*>(data.data()));
+    return result;
+}
+
+JNIEXPORT jstring JNICALL Java_com_sun_webkit_WebPage_twkOpenTemporaryFile
+    (JNIEnv* env, jclass, jstring prefix, jstring directory, jbyteArray data)
+{
+    auto [path, handle] = FileSystem::openTemporaryFile(String(env, prefix), { }, String(env, directory));
+    if (!handle)
+        return nullptr;
+
+    Vector<uint8_t> bytes(env->GetArrayLength(data));
+    env->GetByteArrayRegion(data, 0, bytes.size(), reinterpret_cast<jbyte*>(bytes.mutableSpan().data()));
+    if (handle.write(bytes.span()) != bytes.size())
+        return nullptr;
+    return path.toJavaString(env).releaseLocal();
+}
+
+JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkSetBytecodeCacheDirectory
+    (JNIEnv* env, jclass, jstring path)
+{
+    BytecodeCacheJava::setDirectory(String(env, path));
+}
+
+JNIEXPORT jint JNICALL Java_com_sun_webkit_WebPage_twkGetLoadedBytecodeCacheCount
+    (JNIEnv*, jclass)
+{
+    return BytecodeCacheJava::loadedCacheFileCount();
+}
+
+JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkPurgeMemoryCache
+    (JNIEnv*, jclass)
+{
+    MemoryCache::singleton().evictResources();
+    GarbageCollectionController::singleton().garbageCollectNow();
+}
+
+JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkSetRenderQueueEncodingVersion
+    (JNIEnv*, jclass, jint version)
+{
+    RenderingQueue::setEncodingVersion(std::clamp<jint>(version,
+        com_sun_webkit_graphics_GraphicsDecoder_ENCODING_VERSION_FLOAT_COLORS,
+        com_sun_webkit_graphics_GraphicsDecoder_ENCODING_VERSION));
+}
+
 JNIEXPORT jlong JNICALL Java_com_sun_webkit_WebPage_twkCreatePage
     (JNIEnv* env, jobject self, jboolean editable)
 {
@@ -1761,6 +2072,52 @@ JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkUpdateContent
     WebPage::webPageFromJLong(pPage)->paint(rq, x, y, w, h);
 }
 
+JNIEXPORT jint JNICALL Java_com_sun_webkit_WebPage_twkGetElidedCommandCount
+  (JNIEnv*, jobject, jlong pPage)
+{
+    return WebPage::webPageFromJLong(pPage)->lastPaintElidedCommandCount();
+}
+
+JNIEXPORT jint JNICALL Java_com_sun_webkit_WebPage_twkGetCanvasFlushedBufferCount
+  (JNIEnv* env, jobject, jlong pPage, jstring id)
+{
+    Page* page = WebPage::pageFromJLong(pPage);
+    RefPtr document = page ? page->localTopDocument() : nullptr;
+    if (!document)
+        return -1;
+
+    RefPtr canvas = dynamicDowncast<HTMLCanvasElement>(document->getElementById(AtomString { String(env, id) }));
+    ImageBuffer* buffer = canvas ? canvas->buffer() : nullptr;
+    if (!buffer)
+        return -1;
+    return buffer->context().platformContext()->queue().flushedBufferCount();
+}
+
+JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkSetDefersLoading
+  (JNIEnv*, jobject, jlong pPage, jboolean defers)
+{
+    if (Page* page = WebPage::pageFromJLong(pPage))
+        page->setDefersLoading(jbool_to_bool(defers));
+}
+
+JNIEXPORT jintArray JNICALL Java_com_sun_webkit_WebPage_twkGetAnimatedLayersDirtyRect
+  (JNIEnv* env, jobject, jlong pPage)
+{
+    IntRect rect = WebPage::webPageFromJLong(pPage)->lastAnimatedLayersDirtyRect();
+    jint values[] = { rect.x(), rect.y(), rect.width(), rect.height() };
+    jintArray result = env->NewIntArray(4);
+    if (!result || WTF::CheckAndClearException(env))
+        return nullptr;
+    env->SetIntArrayRegion(result, 0, 4, values);
+    return result;
+}
+
+JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkSetFontSmoothingType
+    (JNIEnv*, jobject, jlong pPage, jint fontSmoothingType)
+{
+    WebPage::webPageFromJLong(pPage)->setFontSmoothingType(fontSmoothingType);
+}
+
 JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkUpdateRendering
     (JNIEnv*, jobject, jlong pPage)
 {
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2021, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -26,6 +26,8 @@
 #pragma once
 
 #include <wtf/OptionSet.h>
+#include <wtf/Vector.h>
+#include <wtf/WeakPtr.h>
 #include <wtf/java/JavaRef.h>
 #include <WebCore/GraphicsLayerClient.h>
 #include <WebCore/IntRect.h>
@@ -34,6 +36,7 @@
 #include <WebCore/HandleUserInputEventResult.h>
 
 #include "MediaPlayerPrivateJava.h"
+#include "PageTileCache.h"
 #include "TextureMapperJavaAdapter.h"
 
 #include <jni.h> // todo tav remove when building w/ pch
@@ -45,13 +48,16 @@ class GraphicsContext;
 class GraphicsLayer;
 class IntRect;
 class IntSize;
+class LocalFrameView;
 class Node;
 class Page;
 class PlatformKeyboardEvent;
 class TextureMapper;
+class TextureMapperLayer;
 
 class WebPage
     : GraphicsLayerClient
+    , public CanMakeWeakPtr<WebPage>
 {
 public:
     WebPage(RefPtr<Page> page);
@@ -86,12 +92,18 @@ public:
     void setSize(const IntSize&);
     void prePaint();
     void paint(jobject, jint, jint, jint, jint);
+    // Queue commands the last paint() dropped as redundant, for profiling.
+    unsigned lastPaintElidedCommandCount() const { return m_lastPaintElidedCommandCount; }
     void postPaint(jobject, jint, jint, jint, jint);
+    // Part of the page the last postPaint() asked to repaint for the running
+    // animations, empty if there were none. For testing.
+    IntRect lastAnimatedLayersDirtyRect() const { return m_lastAnimatedLayersDirtyRect; }
     bool processKeyEvent(const PlatformKeyboardEvent& event);
 
     void scroll(const IntSize& scrollDelta, const IntRect& rectToScroll,
                 const IntRect& clipRect);
     void repaint(const IntRect&);
+    void setFontSmoothingType(int);
     int beginPrinting(float width, float height);
     void print(GraphicsContext& gc, int pageIndex, float pageWidth);
     void endPrinting();
@@ -107,10 +119,14 @@ public:
 
 private:
     void requestJavaRepaint(const IntRect&);
+    void flushPendingRepaints();
     void markForSync();
     void syncLayers();
     IntRect pageRect();
     void renderCompositedLayers(GraphicsContext&, const IntRect&);
+    IntRect animatedLayersDirtyRect(TextureMapperLayer&);
+    bool updateTileCacheState(LocalFrameView&);
+    void paintWithTileCache(GraphicsContext&, LocalFrameView&, const IntRect&);
 
     // GraphicsLayerClient
     void notifyAnimationStarted(const GraphicsLayer*, const String& /*animationKey*/, MonotonicTime /*time*/) override;
@@ -137,6 +153,22 @@ private:
     std::unique_ptr<TextureMapper> m_textureMapper;
     bool m_syncLayers { false };
 
+    // Bounds of the animated layer subtrees as of the last composited frame,
+    // see animatedLayersDirtyRect().
+    Vector<FloatRect> m_animatedLayerBounds;
+    IntRect m_lastAnimatedLayersDirtyRect;
+
+    // Repaint requests are batched and handed to Java once per run loop
+    // iteration, see requestJavaRepaint().
+    Vector<IntRect> m_pendingRepaintRects;
+
+    // Contents of the main frame rasterized by previous paints when it is
+    // not composited, see updateTileCacheState().
+    PageTileCache m_tileCache;
+    IntPoint m_tileCacheScrollPosition;
+
+    unsigned m_lastPaintElidedCommandCount { 0 };
+
     // Webkit expects keyPress events to be suppressed if the associated keyDown
     // event was handled. Safari implements this behavior by peeking out the
     // associated WM_CHAR event if the keydown was handled. We emulate
@@ -78,6 +78,8 @@ else()
 endif()
 
 WEBKIT_OPTION_BEGIN()
+WEBKIT_OPTION_DEFINE(USE_JAVA_FREETYPE "Whether to read glyph metrics of font files with FreeType instead of through WCFont (Linux only)." PRIVATE OFF)
+
 WEBKIT_OPTION_DEFAULT_PORT_VALUE(ENABLE_DRAG_SUPPORT PUBLIC ON)
 WEBKIT_OPTION_DEFAULT_PORT_VALUE(ENABLE_TOUCH_EVENTS PUBLIC OFF)
 WEBKIT_OPTION_DEFAULT_PORT_VALUE(ENABLE_VIDEO PUBLIC ON)
@@ -137,6 +139,13 @@ endif ()
 # this point, and do not attempt to change any option after this point.
 WEBKIT_OPTION_END()
 
+if (USE_JAVA_FREETYPE)
+    if (APPLE OR WIN32)
+        message(FATAL_ERROR "USE_JAVA_FREETYPE is only supported on Linux")
+    endif ()
+    find_package(Freetype 2.4.2 REQUIRED)
+endif ()
+
 
 set(ENABLE_WEBKIT_LEGACY ON)
 set(ENABLE_WEBKIT OFF)
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017, 2021, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2017, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -43,6 +43,79 @@ public class WebPageShim {
         return page.test_getFramesCount();
     }
 
+    public static void setRenderQueueEncodingVersion(int version) {
+        WebPage.test_setRenderQueueEncodingVersion(version);
+    }
+
+    public static void setDefersCanvasDrawing(boolean defers) {
+        WebPage.test_setDefersCanvasDrawing(defers);
+    }
+
+    public static int getCanvasFlushedBufferCount(WebPage page, String id) {
+        return page.test_getCanvasFlushedBufferCount(id);
+    }
+
+    public static void setDefersLoading(WebPage page, boolean defers) {
+        page.test_setDefersLoading(defers);
+    }
+
+    public static int getCachedJavaClassCount(String className) {
+        return WebPage.test_getCachedJavaClassCount(className);
+    }
+
+    public static void setBytecodeCacheDirectory(String path) {
+        WebPage.test_setBytecodeCacheDirectory(path);
+    }
+
+    public static int getLoadedBytecodeCacheCount() {
+        return WebPage.test_getLoadedBytecodeCacheCount();
+    }
+
+    public static void purgeMemoryCache() {
+        WebPage.test_purgeMemoryCache();
+    }
+
+    public static String[] listDirectory(String path) {
+        return WebPage.test_listDirectory(path);
+    }
+
+    public static boolean deleteNonEmptyDirectory(String path) {
+        return WebPage.test_deleteNonEmptyDirectory(path);
+    }
+
+    public static boolean moveFile(String oldPath, String newPath) {
+        return WebPage.test_moveFile(oldPath, newPath);
+    }
+
+    public static boolean copyFile(String targetPath, String sourcePath) {
+        return WebPage.test_copyFile(targetPath, sourcePath);
+    }
+
+    public static boolean hardLinkOrCopyFile(String targetPath, String linkPath) {
+        return WebPage.test_hardLinkOrCopyFile(targetPath, linkPath);
+    }
+
+    public static byte[] mapFile(String path) {
+        return WebPage.test_mapFile(path);
+    }
+
+    public static String openTemporaryFile(String prefix, String directory, byte[] data) {
+        return WebPage.test_openTemporaryFile(prefix, directory, data);
+    }
+
+    public static int getRenderQueueSize(WebPage page, int x, int y, int w, int h) {
+        page.setBounds(x, y, w, h);
+        return page.test_getRenderQueueSize(x, y, w, h);
+    }
+
+    public static int getElidedCommandCount(WebPage page) {
+        return page.test_getElidedCommandCount();
+    }
+
+    public static WCRectangle getAnimatedLayersDirtyRect(WebPage page) {
+        return page.test_getAnimatedLayersDirtyRect();
+    }
+
     private static WCGraphicsContext setupPageWithGraphics(WebPage page, int x, int y, int w, int h) {
         page.setBounds(x, y, w, h);
         // forces layout and renders the page into RenderQueue.
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -23,32 +23,14 @@
  * questions.
  */
 
-#include "config.h"
+package com.sun.webkit.graphics;
 
-#include "BitmapTextureJava.h"
-#include "GraphicsLayer.h"
-#include "NotImplemented.h"
-#include "PlatformContextJava.h"
-#include "TextureMapperJava.h"
-#include <stdio.h>
-namespace WebCore {
+import com.sun.prism.paint.Color;
+import java.nio.ByteBuffer;
 
+public class GraphicsDecoderShim {
 
-void BitmapTextureJava::updateContents(const void*, const IntRect& target, const IntPoint& sourceOffset, int bytesPerLine)
-{
-    notImplemented();
+    public static Color getPackedColor(ByteBuffer buf) {
+        return GraphicsDecoder.getPackedColor(buf);
+    }
 }
-
-void BitmapTextureJava::didReset()
-{
-    float devicePixelRatio = 1.0;
-    m_image = ImageBuffer::create(contentSize(), RenderingMode::Unaccelerated, RenderingPurpose::Unspecified, devicePixelRatio,
-                         DestinationColorSpace::SRGB(), PixelFormat::BGRA8);
-}
-
-void BitmapTextureJava::updateContents(NativeImage* image, const IntRect& targetRect, const IntPoint& offset)
-{
-    //m_image->context().drawImage(*image, targetRect, IntRect(offset, targetRect.size()));
-}
-
-} // namespace WebCore
@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package test.com.sun.webkit.graphics;
+
+import com.sun.prism.paint.Color;
+import com.sun.webkit.graphics.GraphicsDecoderShim;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import org.junit.Test;
+import static org.junit.Assert.assertEquals;
+
+public class GraphicsDecoderTest {
+
+    private static int pack(int r, int g, int b, int a) {
+        // Same layout as packedColor() in GraphicsContextJava.cpp
+        return (a << 24) | (r << 16) | (g << 8) | b;
+    }
+
+    private static Color decode(int argb) {
+        ByteBuffer buf = ByteBuffer.allocate(4).order(ByteOrder.nativeOrder());
+        buf.putInt(argb);
+        buf.flip();
+        Color c = GraphicsDecoderShim.getPackedColor(buf);
+        assertEquals("packed color must consume exactly one int", 0, buf.remaining());
+        return c;
+    }
+
+    @Test
+    public void testPackedColorRoundTrip() {
+        for (int v = 0; v <= 0xFF; v++) {
+            // Must match the float form the native side would have sent
+            // for the same 8-bit component, i.e. v / 255.
+            float expected = v / 255f;
+            Color c = decode(pack(v, 0xFF - v, v, 0xFF - v));
+            assertEquals(expected, c.getRed(), 0f);
+            assertEquals(1f - expected, c.getGreen(), 1e-6f);
+            assertEquals(expected, c.getBlue(), 0f);
+            assertEquals(1f - expected, c.getAlpha(), 1e-6f);
+        }
+    }
+
+    @Test
+    public void testPackedColorOpaqueAndTransparent() {
+        Color white = decode(pack(0xFF, 0xFF, 0xFF, 0xFF));
+        assertEquals(Color.WHITE, white);
+
+        Color transparent = decode(pack(0, 0, 0, 0));
+        assertEquals(Color.TRANSPARENT, transparent);
+    }
+}
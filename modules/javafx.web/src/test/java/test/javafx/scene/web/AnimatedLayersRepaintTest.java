@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package test.javafx.scene.web;
+
+import com.sun.webkit.WebPage;
+import com.sun.webkit.WebPageShim;
+import com.sun.webkit.graphics.WCRectangle;
+import javafx.scene.web.WebEngineShim;
+import org.junit.Before;
+import org.junit.Test;
+import static org.junit.Assert.assertFalse;
+import static org.junit.Assert.assertNotNull;
+import static org.junit.Assert.assertTrue;
+
+public class AnimatedLayersRepaintTest extends TestBase {
+    private static final int PAGE_SIZE = 400;
+
+    private static String page(String keyframes, String animated) {
+        return "<html>\n" +
+                "<head><style>\n" +
+                keyframes + "\n" +
+                "div { position: absolute; left: 0px; top: 0px; }\n" +
+                "</style></head>\n" +
+                "<body style='margin: 0px;'>\n" +
+                animated + "\n" +
+                "</body>\n" +
+                "</html>";
+    }
+
+    @Before public void setUp() {
+        submit(() -> {
+            final WebPage webPage = WebEngineShim.getPage(getEngine());
+            assertNotNull(webPage);
+            // Animations only run on composited layers.
+            webPage.overridePreference("WebKitAcceleratedCompositingEnabled", "1");
+        });
+    }
+
+    private WCRectangle paintAndGetDirtyRect() {
+        return submit(() -> {
+            final WebPage webPage = WebEngineShim.getPage(getEngine());
+            // The first paint starts the animations.
+            WebPageShim.paint(webPage, 0, 0, PAGE_SIZE, PAGE_SIZE);
+            WebPageShim.paint(webPage, 0, 0, PAGE_SIZE, PAGE_SIZE);
+            return WebPageShim.getAnimatedLayersDirtyRect(webPage);
+        });
+    }
+
+    private static boolean contains(WCRectangle rect, int x, int y, int w, int h) {
+        return rect.getX() <= x && rect.getY() <= y
+                && rect.getX() + rect.getWidth() >= x + w
+                && rect.getY() + rect.getHeight() >= y + h;
+    }
+
+    private static void assertNotWholePage(WCRectangle rect) {
+        assertFalse("Whole page repainted: " + rect,
+                contains(rect, 0, 0, PAGE_SIZE, PAGE_SIZE));
+    }
+
+    @Test public void testTransformAnimationCoversItsExtent() {
+        loadContent(page(
+                "@keyframes move { from { transform: translateX(0px); } to { transform: translateX(200px); } }",
+                "<div style='width: 50px; height: 50px; background-color: red;" +
+                " animation: move 10s linear infinite;'></div>"));
+        final WCRectangle rect = paintAndGetDirtyRect();
+        assertTrue("Dirty rect " + rect, contains(rect, 0, 0, 250, 50));
+        assertNotWholePage(rect);
+    }
+
+    @Test public void testFilterAnimationCoversItsOutsets() {
+        loadContent(page(
+                "@keyframes blur { from { filter: blur(0px); } to { filter: blur(10px); } }",
+                "<div style='left: 150px; top: 150px; width: 50px; height: 50px;" +
+                " background-color: red; animation: blur 10s linear infinite;'></div>"));
+        final WCRectangle rect = paintAndGetDirtyRect();
+        assertTrue("Dirty rect " + rect, contains(rect, 150, 150, 50, 50));
+        assertNotWholePage(rect);
+    }
+
+    @Test public void testAnimationInsideAnimatedLayerIsCovered() {
+        // The outer layer only fades, the inner one moves out of it.
+        loadContent(page(
+                "@keyframes fade { from { opacity: 1; } to { opacity: 0.5; } }\n" +
+                "@keyframes drop { from { transform: translateY(0px); } to { transform: translateY(250px); } }",
+                "<div style='width: 100px; height: 100px; animation: fade 10s linear infinite;'>" +
+                "<div style='width: 50px; height: 50px; background-color: red;" +
+                " animation: drop 10s linear infinite;'></div></div>"));
+        final WCRectangle rect = paintAndGetDirtyRect();
+        assertTrue("Dirty rect " + rect, contains(rect, 0, 0, 50, 300));
+        assertNotWholePage(rect);
+    }
+}
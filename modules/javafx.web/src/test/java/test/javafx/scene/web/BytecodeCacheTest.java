@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package test.javafx.scene.web;
+
+import com.sun.webkit.WebPageShim;
+import java.io.File;
+import java.io.IOException;
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.util.Comparator;
+import java.util.List;
+import java.util.stream.Collectors;
+import java.util.stream.Stream;
+import org.junit.After;
+import org.junit.Before;
+import org.junit.Test;
+import static org.junit.Assert.assertEquals;
+import static org.junit.Assert.assertTrue;
+import static org.junit.Assume.assumeTrue;
+
+public class BytecodeCacheTest extends TestBase {
+
+    private Path rootDirectory;
+    private Path cacheDirectory;
+    private Path page;
+
+    @Before
+    public void setUp() throws IOException {
+        // The cache is only written where the native file system access is.
+        assumeTrue(System.getProperty("os.name").startsWith("Linux"));
+
+        rootDirectory = Files.createTempDirectory("webkit-bytecode");
+        cacheDirectory = rootDirectory.resolve("cache").resolve("nested");
+        Path script = rootDirectory.resolve("script.js");
+        Files.writeString(script,
+                "function square(x) { return x * x; }\n" +
+                "function sumOfSquares(n) {\n" +
+                "    var sum = 0;\n" +
+                "    for (var i = 1; i <= n; i++) sum += square(i);\n" +
+                "    return sum;\n" +
+                "}\n" +
+                "var result = sumOfSquares(10);\n");
+        page = rootDirectory.resolve("index.html");
+        Files.writeString(page, "<html><body><script src='script.js'></script></body></html>");
+
+        submit(() -> WebPageShim.setBytecodeCacheDirectory(cacheDirectory.toString()));
+    }
+
+    @After
+    public void tearDown() throws IOException {
+        if (rootDirectory == null) {
+            return;
+        }
+        submit(() -> WebPageShim.setBytecodeCacheDirectory(""));
+        try (Stream<Path> paths = Files.walk(rootDirectory)) {
+            paths.sorted(Comparator.reverseOrder()).map(Path::toFile).forEach(File::delete);
+        }
+    }
+
+    private List<Path> cacheFiles() throws IOException {
+        try (Stream<Path> paths = Files.list(cacheDirectory)) {
+            return paths.filter(path -> path.toString().endsWith(".bytecode-cache"))
+                    .collect(Collectors.toList());
+        }
+    }
+
+    @Test public void testBytecodeIsWrittenAndReadBack() throws IOException {
+        assertTrue("Cache directory is created", Files.isDirectory(cacheDirectory));
+
+        load(page.toFile());
+        assertEquals(385, executeScript("result"));
+        List<Path> files = cacheFiles();
+        assertEquals("Cache file is written", 1, files.size());
+        assertTrue("Cache file has bytecode", Files.size(files.get(0)) > 0);
+
+        int loadedCount = submit(() -> WebPageShim.getLoadedBytecodeCacheCount());
+        load(page.toFile());
+        assertEquals(385, executeScript("result"));
+        assertTrue("Cache file is read back",
+                submit(() -> WebPageShim.getLoadedBytecodeCacheCount()) > loadedCount);
+        assertEquals(files, cacheFiles());
+    }
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2015, 2020, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2015, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -25,6 +25,8 @@
 
 package test.javafx.scene.web;
 
+import com.sun.webkit.WebPage;
+import com.sun.webkit.WebPageShim;
 import java.awt.Color;
 import java.awt.image.BufferedImage;
 import java.io.ByteArrayInputStream;
@@ -32,6 +34,7 @@ import java.io.ByteArrayOutputStream;
 import java.io.PrintStream;
 import java.util.Base64;
 import javax.imageio.ImageIO;
+import javafx.scene.web.WebEngineShim;
 
 import netscape.javascript.JSObject;
 import org.junit.After;
@@ -125,6 +128,138 @@ public class CanvasTest extends TestBase {
         });
     }
 
+    private boolean isPointInPath(String path, double x, double y, String rule) {
+        return (Boolean) getEngine().executeScript(
+                "document.getElementById('canvas').getContext('2d')" +
+                ".isPointInPath(" + path + ", " + x + ", " + y + ", '" + rule + "')");
+    }
+
+    @Test public void testIsPointInPathWindingRules() {
+        // Two nested squares drawn in the same direction.
+        loadContent("<canvas id='canvas' width='200' height='200'></canvas><script>" +
+                "var nested = new Path2D();" +
+                "nested.rect(10, 10, 100, 100);" +
+                "nested.rect(30, 30, 60, 60);" +
+                "</script>");
+        submit(() -> {
+            assertTrue(isPointInPath("nested", 20, 20, "nonzero"));
+            assertTrue(isPointInPath("nested", 20, 20, "evenodd"));
+            assertTrue(isPointInPath("nested", 60, 60, "nonzero"));
+            assertFalse(isPointInPath("nested", 60, 60, "evenodd"));
+            assertFalse(isPointInPath("nested", 150, 60, "nonzero"));
+            assertFalse(isPointInPath("nested", 150, 60, "evenodd"));
+        });
+    }
+
+    @Test public void testIsPointInPathOnEdge() {
+        // Points on the left and top edges are inside, points on the right
+        // and bottom edges are not, as for the Java path.
+        loadContent("<canvas id='canvas' width='200' height='200'></canvas><script>" +
+                "var square = new Path2D();" +
+                "square.moveTo(10, 10);" +
+                "square.lineTo(110, 10);" +
+                "square.lineTo(110, 110);" +
+                "square.lineTo(10, 110);" +
+                "square.closePath();" +
+                "var arcSquare = new Path2D(square);" +
+                "arcSquare.arc(300, 300, 1, 0, Math.PI, false);" +
+                "</script>");
+        submit(() -> {
+            for (String path : new String[] { "square", "arcSquare" }) {
+                for (String rule : new String[] { "nonzero", "evenodd" }) {
+                    assertTrue(path + " left edge", isPointInPath(path, 10, 50, rule));
+                    assertTrue(path + " top edge", isPointInPath(path, 50, 10, rule));
+                    assertFalse(path + " right edge", isPointInPath(path, 110, 50, rule));
+                    assertFalse(path + " bottom edge", isPointInPath(path, 50, 110, rule));
+                }
+            }
+        });
+    }
+
+    @Test public void testIsPointInPathAfterAddPathWithTransform() {
+        // Rects cannot be transformed in place, so the added path is kept
+        // by the Java path.
+        loadContent("<canvas id='canvas' width='300' height='300'></canvas><script>" +
+                "var source = new Path2D();" +
+                "source.rect(0, 0, 50, 50);" +
+                "var added = new Path2D();" +
+                "added.addPath(source, { a: 2, d: 2, e: 10, f: 10 });" +
+                "var ctx = document.getElementById('canvas').getContext('2d');" +
+                "ctx.fillStyle = 'red';" +
+                "ctx.fill(added);" +
+                "</script>");
+        submit(() -> {
+            assertTrue(isPointInPath("added", 60, 60, "nonzero"));
+            assertTrue(isPointInPath("added", 105, 105, "nonzero"));
+            assertFalse(isPointInPath("added", 5, 5, "nonzero"));
+            assertFalse(isPointInPath("added", 115, 60, "nonzero"));
+            assertEquals("Added path is drawn", 255, (int) getEngine().executeScript(
+                    "document.getElementById('canvas').getContext('2d').getImageData(100, 100, 1, 1).data[0]"));
+        });
+    }
+
+    @Test public void testImageOutlivesCanvasPixels() {
+        // The pattern keeps the image of the source canvas, whose pixels are
+        // released by the resize while their upload may still be pending.
+        loadContent("<canvas id='canvas' width='100' height='100'></canvas><script>" +
+                "var ctx = document.getElementById('canvas').getContext('2d');" +
+                "for (var i = 0; i < 20; i++) {" +
+                "    var source = document.createElement('canvas');" +
+                "    source.width = source.height = 10;" +
+                "    var sourceCtx = source.getContext('2d');" +
+                "    var data = sourceCtx.createImageData(10, 10);" +
+                "    for (var j = 0; j < data.data.length; j += 4) {" +
+                "        data.data[j] = 255;" +
+                "        data.data[j + 3] = 255;" +
+                "    }" +
+                "    sourceCtx.putImageData(data, 0, 0);" +
+                "    var pattern = ctx.createPattern(source, 'repeat');" +
+                "    source.width = 0;" +
+                "    ctx.fillStyle = pattern;" +
+                "    ctx.fillRect(0, 0, 100, 100);" +
+                "}" +
+                "</script>");
+        submit(() -> {
+            assertEquals("Pattern is drawn", 255, (int) getEngine().executeScript(
+                    "document.getElementById('canvas').getContext('2d').getImageData(55, 55, 1, 1).data[0]"));
+            assertEquals("Pattern is opaque", 255, (int) getEngine().executeScript(
+                    "document.getElementById('canvas').getContext('2d').getImageData(55, 55, 1, 1).data[3]"));
+        });
+    }
+
+    private static final String DRAW_MANY_RECTS =
+            "for (var i = 0; i < 5000; i++) {" +
+            "    ctx.fillStyle = 'rgb(' + (i % 256) + ', 0, 0)';" +
+            "    ctx.fillRect(i % 90, i % 90, 10, 10);" +
+            "}";
+
+    @Test public void testDeferredCanvasDrawingIsHeldUntilUsed() {
+        loadContent("<canvas id='deferred' width='100' height='100'></canvas>" +
+                "<canvas id='immediate' width='100' height='100'></canvas>");
+        submit(() -> {
+            final WebPage page = WebEngineShim.getPage(getEngine());
+            try {
+                WebPageShim.setDefersCanvasDrawing(true);
+                getEngine().executeScript(
+                        "var ctx = document.getElementById('deferred').getContext('2d');" +
+                        DRAW_MANY_RECTS);
+                assertEquals("Drawing is held", 0,
+                        WebPageShim.getCanvasFlushedBufferCount(page, "deferred"));
+                getEngine().executeScript("ctx.getImageData(0, 0, 1, 1)");
+                assertTrue("Drawing is handed over when used",
+                        WebPageShim.getCanvasFlushedBufferCount(page, "deferred") > 0);
+            } finally {
+                WebPageShim.setDefersCanvasDrawing(false);
+            }
+
+            getEngine().executeScript(
+                    "var ctx = document.getElementById('immediate').getContext('2d');" +
+                    DRAW_MANY_RECTS);
+            assertTrue("Drawing is handed over as the queue fills",
+                    WebPageShim.getCanvasFlushedBufferCount(page, "immediate") > 0);
+        });
+    }
+
     // JDK-8234471
     @Ignore("JDK-8347937")
     @Test public void testCanvasPattern() throws Exception {
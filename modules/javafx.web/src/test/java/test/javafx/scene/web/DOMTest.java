@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2020, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -435,6 +435,35 @@ public class DOMTest extends TestBase {
         });
     }
 
+    @Test public void testBatchedQueries() {
+        loadContent("<div id='box' class='a' style='width: 40px; height: 20px'>"
+                + "text<span title='t'></span></div><p></p>");
+        submit(() -> {
+            final Document doc = getEngine().getDocument();
+            ElementImpl div = (ElementImpl) doc.getElementById("box");
+            String[] attrs = div.getAttributeNamesAndValues();
+            assertEquals("Attribute names and values", 6, attrs.length);
+            for (int i = 0; i < attrs.length; i += 2) {
+                assertEquals("Value of " + attrs[i],
+                        div.getAttribute(attrs[i]), attrs[i + 1]);
+            }
+
+            NodeList nodes = div.getChildNodes();
+            double[] rects = ((NodeListImpl) nodes).getBoundingClientRects();
+            assertEquals("Rects length", 4 * nodes.getLength(), rects.length);
+            assertEquals("Text node rect width", 0.0, rects[2], 0.0);
+
+            rects = ((NodeListImpl) doc.getElementsByTagName("div")).getBoundingClientRects();
+            assertEquals("Div width", div.getOffsetWidth(), rects[2], 0.0);
+            assertEquals("Div height", div.getOffsetHeight(), rects[3], 0.0);
+
+            String snapshot = div.getSubtreeSnapshot();
+            assertTrue(snapshot, snapshot.startsWith("{\"tag\":\"DIV\""));
+            assertTrue(snapshot, snapshot.contains("\"text\":\"text\""));
+            assertTrue(snapshot, snapshot.contains("\"title\":\"t\""));
+        });
+    }
+
     // helper methods
 
     private void verifyChildRemoved(Node parent,
@@ -0,0 +1,178 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package test.javafx.scene.web;
+
+import com.sun.webkit.WebPageShim;
+import java.io.File;
+import java.io.IOException;
+import java.nio.charset.StandardCharsets;
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.nio.file.Paths;
+import java.util.Arrays;
+import java.util.Comparator;
+import java.util.stream.Stream;
+import org.junit.After;
+import org.junit.Before;
+import org.junit.Test;
+import static org.junit.Assert.assertArrayEquals;
+import static org.junit.Assert.assertEquals;
+import static org.junit.Assert.assertFalse;
+import static org.junit.Assert.assertNotNull;
+import static org.junit.Assert.assertTrue;
+import static org.junit.Assume.assumeTrue;
+
+/**
+ * Tests the native file system access WebKit uses on Linux.
+ */
+public class FileSystemTest extends TestBase {
+
+    private static final byte[] CONTENTS = "file contents".getBytes(StandardCharsets.UTF_8);
+
+    private Path directory;
+
+    @Before
+    public void setUp() throws IOException {
+        assumeTrue(System.getProperty("os.name").startsWith("Linux"));
+        directory = Files.createTempDirectory("webkit-fs");
+    }
+
+    @After
+    public void tearDown() throws IOException {
+        if (directory != null) {
+            deleteRecursively(directory);
+        }
+    }
+
+    private static void deleteRecursively(Path path) throws IOException {
+        if (!Files.exists(path)) {
+            return;
+        }
+        try (Stream<Path> paths = Files.walk(path)) {
+            paths.sorted(Comparator.reverseOrder()).map(Path::toFile).forEach(File::delete);
+        }
+    }
+
+    private Path createFile(Path path) throws IOException {
+        Files.createDirectories(path.getParent());
+        return Files.write(path, CONTENTS);
+    }
+
+    @Test public void testListDirectory() throws IOException {
+        createFile(directory.resolve("a.txt"));
+        createFile(directory.resolve(".hidden"));
+        Files.createDirectory(directory.resolve("sub"));
+
+        String[] fileNames = submit(() -> WebPageShim.listDirectory(directory.toString()));
+        Arrays.sort(fileNames);
+        assertArrayEquals(new String[] { ".hidden", "a.txt", "sub" }, fileNames);
+
+        assertEquals(0, (int) submit(() ->
+                WebPageShim.listDirectory(directory.resolve("missing").toString()).length));
+    }
+
+    @Test public void testDeleteNonEmptyDirectory() throws IOException {
+        Path tree = directory.resolve("tree");
+        createFile(tree.resolve("a.txt"));
+        createFile(tree.resolve("sub/b.txt"));
+        createFile(tree.resolve("sub/deeper/c.txt"));
+        Files.createDirectories(tree.resolve("empty"));
+
+        assertTrue(submit(() -> WebPageShim.deleteNonEmptyDirectory(tree.toString())));
+        assertFalse(Files.exists(tree));
+    }
+
+    @Test public void testMoveFile() throws IOException {
+        Path source = createFile(directory.resolve("source.txt"));
+        Path target = directory.resolve("target.txt");
+
+        assertTrue(submit(() -> WebPageShim.moveFile(source.toString(), target.toString())));
+        assertFalse(Files.exists(source));
+        assertArrayEquals(CONTENTS, Files.readAllBytes(target));
+    }
+
+    @Test public void testMoveFileAcrossFileSystems() throws IOException {
+        // rename() fails with EXDEV across file systems, so the file is
+        // copied and the source deleted instead.
+        Path shm = Paths.get("/dev/shm");
+        assumeTrue(Files.isDirectory(shm) && Files.isWritable(shm));
+        assumeTrue(!Files.getAttribute(shm, "unix:dev").equals(
+                Files.getAttribute(directory, "unix:dev")));
+
+        Path otherDirectory = Files.createTempDirectory(shm, "webkit-fs");
+        try {
+            Path source = createFile(otherDirectory.resolve("source.txt"));
+            Path target = directory.resolve("target.txt");
+
+            assertTrue(submit(() -> WebPageShim.moveFile(source.toString(), target.toString())));
+            assertFalse(Files.exists(source));
+            assertArrayEquals(CONTENTS, Files.readAllBytes(target));
+        } finally {
+            deleteRecursively(otherDirectory);
+        }
+    }
+
+    @Test public void testCopyFile() throws IOException {
+        Path source = createFile(directory.resolve("source.txt"));
+        Path target = directory.resolve("target.txt");
+        Files.write(target, new byte[CONTENTS.length * 2]);
+
+        // The target is replaced, not appended to.
+        assertTrue(submit(() -> WebPageShim.copyFile(target.toString(), source.toString())));
+        assertArrayEquals(CONTENTS, Files.readAllBytes(source));
+        assertArrayEquals(CONTENTS, Files.readAllBytes(target));
+
+        assertFalse(submit(() -> WebPageShim.copyFile(target.toString(),
+                directory.resolve("missing.txt").toString())));
+    }
+
+    @Test public void testHardLinkOrCopyFile() throws IOException {
+        Path source = createFile(directory.resolve("source.txt"));
+        Path link = directory.resolve("link.txt");
+
+        assertTrue(submit(() -> WebPageShim.hardLinkOrCopyFile(source.toString(), link.toString())));
+        assertArrayEquals(CONTENTS, Files.readAllBytes(link));
+        // Within a directory the link does not have to fall back to a copy.
+        assertEquals(Files.getAttribute(source, "unix:ino"), Files.getAttribute(link, "unix:ino"));
+    }
+
+    @Test public void testMapFile() throws IOException {
+        Path file = createFile(directory.resolve("mapped.txt"));
+
+        assertArrayEquals(CONTENTS, submit(() -> WebPageShim.mapFile(file.toString())));
+    }
+
+    @Test public void testOpenTemporaryFileInDirectory() throws IOException {
+        String path = submit(() ->
+                WebPageShim.openTemporaryFile("webkit", directory.toString(), CONTENTS));
+
+        assertNotNull(path);
+        Path file = Paths.get(path);
+        assertEquals(directory, file.getParent());
+        assertTrue(file.getFileName().toString().startsWith("webkit"));
+        assertArrayEquals(CONTENTS, Files.readAllBytes(file));
+    }
+}
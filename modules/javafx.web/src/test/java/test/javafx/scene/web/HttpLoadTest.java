@@ -0,0 +1,230 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package test.javafx.scene.web;
+
+import com.sun.javafx.webkit.UIClientImplShim;
+import com.sun.webkit.WebPageShim;
+import com.sun.webkit.network.NetworkContextShim;
+import java.io.File;
+import java.io.IOException;
+import java.nio.charset.StandardCharsets;
+import java.nio.file.Files;
+import java.util.concurrent.CountDownLatch;
+import java.util.concurrent.TimeUnit;
+import javafx.concurrent.Worker.State;
+import javafx.scene.web.WebEngineShim;
+import org.junit.After;
+import org.junit.Test;
+import static javafx.concurrent.Worker.State.CANCELLED;
+import static javafx.concurrent.Worker.State.RUNNING;
+import static javafx.concurrent.Worker.State.SUCCEEDED;
+import static org.junit.Assert.assertArrayEquals;
+import static org.junit.Assert.assertEquals;
+import static org.junit.Assert.assertNotNull;
+import static org.junit.Assert.assertNull;
+import static org.junit.Assert.assertTrue;
+import static org.junit.Assume.assumeTrue;
+
+/**
+ * Tests loads over HTTP from a local server.
+ */
+public class HttpLoadTest extends TestBase {
+
+    private static final File UPLOAD_FILE = new File("src/test/resources/test/html/HelloWorld.txt");
+
+    // Posts what makeBody() returns for the chosen file, see chooseFile().
+    private static final String UPLOAD_PAGE =
+            "<html><body>" +
+            "<input type='file' id='file' onchange='post(makeBody(event.target.files[0]))'/>" +
+            "<script>" +
+            "window.addEventListener('click', (e) => {" +
+                "document.getElementById('file').click();" +
+            "});" +
+            "function post(body) {" +
+                "var xhr = new XMLHttpRequest();" +
+                "xhr.open('POST', '/upload');" +
+                "xhr.send(body);" +
+            "}" +
+            "</script></body></html>";
+
+    private LocalHttpServer server;
+
+    @After
+    public void tearDown() throws IOException {
+        if (server != null) {
+            server.close();
+        }
+    }
+
+    private State getLoadState() {
+        return submit(() -> getEngine().getLoadWorker().getState());
+    }
+
+    private static String page(int textLength) {
+        return "<html><body><p>" + "x".repeat(textLength) + "</p></body></html>";
+    }
+
+    private int getHandedOffByteBufferCount() {
+        return submit(() -> NetworkContextShim.getHandedOffByteBufferCount());
+    }
+
+    private void loadUploadPage() throws IOException {
+        server = new LocalHttpServer(request -> "POST".equals(request.method)
+                ? new LocalHttpServer.Response("text/plain", "OK")
+                : new LocalHttpServer.Response("text/html", UPLOAD_PAGE));
+        load(server.url("/"));
+        assertEquals(SUCCEEDED, getLoadState());
+    }
+
+    private void chooseFile(String makeBody) {
+        UIClientImplShim.test_setChooseFiles(new String[] { UPLOAD_FILE.getAbsolutePath() });
+        executeScript("var makeBody = " + makeBody);
+        // A click anywhere opens the file chooser, see UPLOAD_PAGE.
+        submit(() -> WebPageShim.click(WebEngineShim.getPage(getEngine()), 0, 0));
+    }
+
+    private LocalHttpServer.Request takePost() throws InterruptedException {
+        for (;;) {
+            LocalHttpServer.Request request = server.takeRequest(10, TimeUnit.SECONDS);
+            assertNotNull("POST request is received", request);
+            if ("POST".equals(request.method)) {
+                assertEquals("/upload", request.path);
+                return request;
+            }
+        }
+    }
+
+    private static byte[] bytes(String string) {
+        return string.getBytes(StandardCharsets.UTF_8);
+    }
+
+    @Test public void testPostInMemoryBody() throws Exception {
+        loadUploadPage();
+
+        executeScript("post('name=value&other=%D0%B4')");
+        assertArrayEquals(bytes("name=value&other=%D0%B4"), takePost().body);
+
+        executeScript("post(new Blob(['0123456789']).slice(2, 6))");
+        assertArrayEquals(bytes("2345"), takePost().body);
+    }
+
+    @Test public void testPostFileBody() throws Exception {
+        loadUploadPage();
+
+        chooseFile("file => file");
+        assertArrayEquals(Files.readAllBytes(UPLOAD_FILE.toPath()), takePost().body);
+    }
+
+    @Test public void testPostFileSliceBody() throws Exception {
+        loadUploadPage();
+
+        // Only the range of the file is read
+        chooseFile("file => file.slice(3, 7)");
+        assertArrayEquals(bytes("lo W"), takePost().body);
+    }
+
+    /**
+     * Starts loading a page the server holds back until the load is
+     * deferred, and returns once it has been sent.
+     */
+    private void startDeferredLoad() throws Exception {
+        final CountDownLatch requested = new CountDownLatch(1);
+        final CountDownLatch deferred = new CountDownLatch(1);
+        server = new LocalHttpServer(request -> {
+            requested.countDown();
+            try {
+                deferred.await();
+            } catch (InterruptedException ex) {
+                throw new AssertionError(ex);
+            }
+            return new LocalHttpServer.Response("text/html",
+                    "<html><body><p id='p'>deferred</p></body></html>");
+        });
+
+        submit(() -> getEngine().load(server.url("/deferred.html")));
+        assertTrue("Page is requested", requested.await(10, TimeUnit.SECONDS));
+        submit(() -> WebPageShim.setDefersLoading(WebEngineShim.getPage(getEngine()), true));
+        deferred.countDown();
+
+        // Give the response time to arrive, then check that none of it
+        // reached WebCore.
+        Thread.sleep(1000);
+        assertEquals(RUNNING, getLoadState());
+        assertNull("No data is delivered while deferred",
+                submit(() -> getEngine().getDocument()));
+    }
+
+    @Test public void testDeferredLoadIsResumed() throws Exception {
+        startDeferredLoad();
+
+        submit(() -> WebPageShim.setDefersLoading(WebEngineShim.getPage(getEngine()), false));
+        waitLoadFinished();
+        assertEquals(SUCCEEDED, getLoadState());
+        assertEquals("deferred", executeScript("document.getElementById('p').textContent"));
+    }
+
+    @Test public void testDeferredLoadIsCanceled() throws Exception {
+        final int baseline = getHandedOffByteBufferCount();
+        startDeferredLoad();
+
+        submit(() -> getEngine().getLoadWorker().cancel());
+        waitLoadFinished();
+        assertEquals(CANCELLED, getLoadState());
+        assertNull(submit(() -> getEngine().getDocument()));
+        assertTrue("Callbacks held back do not keep buffers",
+                getHandedOffByteBufferCount() <= baseline);
+
+        // The page loads again once it is no longer deferred
+        submit(() -> WebPageShim.setDefersLoading(WebEngineShim.getPage(getEngine()), false));
+        loadContent("<html><body><p id='p'>loaded</p></body></html>");
+        assertEquals(SUCCEEDED, getLoadState());
+        assertEquals("loaded", executeScript("document.getElementById('p').textContent"));
+    }
+
+    @Test public void testHandedOffBuffersReturnToPool() throws Exception {
+        assumeTrue(submit(() -> NetworkContextShim.usesHTTP2Loader()));
+        server = new LocalHttpServer(request ->
+                new LocalHttpServer.Response("text/html", page(200 * 1024)));
+
+        final int baseline = getHandedOffByteBufferCount();
+        load(server.url("/page.html"));
+        assertEquals(SUCCEEDED, getLoadState());
+        assertTrue("Response data is handed off to WebCore",
+                getHandedOffByteBufferCount() > baseline);
+
+        // Once the document is gone and its resource evicted, WebCore
+        // drops the data and the buffers go back to the pool.
+        loadContent("<html><body></body></html>");
+        final long deadline = System.currentTimeMillis() + 10000;
+        while (getHandedOffByteBufferCount() > baseline
+                && System.currentTimeMillis() < deadline) {
+            submit(() -> WebPageShim.purgeMemoryCache());
+            Thread.sleep(100);
+        }
+        assertTrue("Handed off buffers are returned to the pool",
+                getHandedOffByteBufferCount() <= baseline);
+    }
+}
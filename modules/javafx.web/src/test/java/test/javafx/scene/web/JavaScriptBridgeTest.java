@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2017, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -25,6 +25,7 @@
 
 package test.javafx.scene.web;
 
+import com.sun.webkit.WebPageShim;
 import javafx.scene.web.WebEngine;
 import netscape.javascript.JSException;
 import netscape.javascript.JSObject;
@@ -39,6 +40,24 @@ public class JavaScriptBridgeTest extends TestBase {
         parent.setMember(name, javaObject);
     }
 
+    public static class ReflectedObject {
+        public int value() {
+            return 1;
+        }
+    }
+
+    // Every call from Java captures a new access control context, which
+    // must not cause the class to be reflected again.
+    @Test public void testClassMetadataIsReusedAcrossCalls() {
+        loadContent("<h1></h1>");
+        submit(() -> {
+            bind("first", new ReflectedObject());
+            bind("second", new ReflectedObject());
+            assertEquals(2, getEngine().executeScript("first.value() + second.value()"));
+            assertEquals(1, WebPageShim.getCachedJavaClassCount(ReflectedObject.class.getName()));
+        });
+    }
+
     public @Test void testJSBridge1() throws InterruptedException {
         final Document doc = getDocumentFor("src/test/resources/test/html/dom.html");
         final WebEngine web = getEngine();
@@ -586,6 +605,52 @@ public class JavaScriptBridgeTest extends TestBase {
         });
     }
 
+    public @Test void testFieldAccessOnManyInstances() throws InterruptedException {
+        final WebEngine web = getEngine();
+
+        submit(() -> {
+            // Instances of a class share the reflected class metadata, which
+            // has to stay usable after the reflected members were collected.
+            for (int i = 0; i < 10; i++) {
+                bind("carry", new Carry(i, 2 * i));
+                assertEquals(3.0 * i, ((Number) web.executeScript("carry.a + carry.b")).doubleValue(), 0.0);
+                web.executeScript("carry.b = 1.5");
+                assertEquals(i + 1.5, ((Number) web.executeScript("carry.a + carry.b")).doubleValue(), 0.0);
+                System.gc();
+            }
+        });
+    }
+
+    public static class PrimitiveArrays {
+        public int sum(int[] values) {
+            int sum = 0;
+            for (int value : values) {
+                sum += value;
+            }
+            return sum;
+        }
+
+        public String chars(char[] values) {
+            return new String(values);
+        }
+
+        public char first(char[] values) {
+            return values[0];
+        }
+    }
+
+    public @Test void testJSArrayToJavaPrimitiveArray() throws InterruptedException {
+        final WebEngine web = getEngine();
+
+        submit(() -> {
+            bind("arrays", new PrimitiveArrays());
+            assertEquals(10, web.executeScript("arrays.sum([1, 2, 3, 4])"));
+            assertEquals(0, web.executeScript("arrays.sum([])"));
+            assertEquals("abc", web.executeScript("arrays.chars(['a', 'b', 'c'])"));
+            assertEquals("x", web.executeScript("String(arrays.first(['x']))"));
+        });
+    }
+
     private void executeShouldFail(WebEngine web, String expression,
                                    String expected) {
         try {
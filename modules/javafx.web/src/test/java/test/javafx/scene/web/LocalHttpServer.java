@@ -0,0 +1,194 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package test.javafx.scene.web;
+
+import java.io.BufferedInputStream;
+import java.io.ByteArrayOutputStream;
+import java.io.IOException;
+import java.io.InputStream;
+import java.io.OutputStream;
+import java.net.InetAddress;
+import java.net.ServerSocket;
+import java.net.Socket;
+import java.net.SocketException;
+import java.nio.charset.StandardCharsets;
+import java.util.Locale;
+import java.util.Map;
+import java.util.TreeMap;
+import java.util.concurrent.BlockingQueue;
+import java.util.concurrent.LinkedBlockingQueue;
+import java.util.concurrent.TimeUnit;
+import java.util.function.Function;
+
+/**
+ * A minimal HTTP/1.1 server on the loopback interface for tests that
+ * need to load over the network. Each request is answered by a handler
+ * and the connection is closed afterwards.
+ */
+final class LocalHttpServer implements AutoCloseable {
+
+    static final class Request {
+        final String method;
+        final String path;
+        final Map<String, String> headers;
+        final byte[] body;
+
+        private Request(String method, String path, Map<String, String> headers, byte[] body) {
+            this.method = method;
+            this.path = path;
+            this.headers = headers;
+            this.body = body;
+        }
+
+        String header(String name) {
+            return headers.get(name.toLowerCase(Locale.ROOT));
+        }
+    }
+
+    static final class Response {
+        final String contentType;
+        final byte[] body;
+
+        Response(String contentType, byte[] body) {
+            this.contentType = contentType;
+            this.body = body;
+        }
+
+        Response(String contentType, String body) {
+            this(contentType, body.getBytes(StandardCharsets.UTF_8));
+        }
+    }
+
+    private final ServerSocket serverSocket;
+    private final Function<Request, Response> handler;
+    private final BlockingQueue<Request> requests = new LinkedBlockingQueue<>();
+    private final Thread thread;
+
+    LocalHttpServer(Function<Request, Response> handler) throws IOException {
+        this.serverSocket = new ServerSocket(0, 50, InetAddress.getLoopbackAddress());
+        this.handler = handler;
+        this.thread = new Thread(this::accept, "LocalHttpServer");
+        thread.setDaemon(true);
+        thread.start();
+    }
+
+    String url(String path) {
+        return "http://localhost:" + serverSocket.getLocalPort() + path;
+    }
+
+    /**
+     * Waits for the next request the server received, returns null on
+     * timeout.
+     */
+    Request takeRequest(long timeout, TimeUnit unit) throws InterruptedException {
+        return requests.poll(timeout, unit);
+    }
+
+    @Override
+    public void close() throws IOException {
+        serverSocket.close();
+    }
+
+    private void accept() {
+        while (!serverSocket.isClosed()) {
+            final Socket socket;
+            try {
+                socket = serverSocket.accept();
+            } catch (IOException ex) {
+                return;
+            }
+            Thread connection = new Thread(() -> serve(socket), "LocalHttpServer connection");
+            connection.setDaemon(true);
+            connection.start();
+        }
+    }
+
+    private void serve(Socket socket) {
+        try (socket) {
+            InputStream in = new BufferedInputStream(socket.getInputStream());
+            String[] requestLine = readLine(in).split(" ");
+            Map<String, String> headers = new TreeMap<>();
+            for (String line = readLine(in); !line.isEmpty(); line = readLine(in)) {
+                int colon = line.indexOf(':');
+                headers.put(line.substring(0, colon).trim().toLowerCase(Locale.ROOT),
+                        line.substring(colon + 1).trim());
+            }
+            byte[] body;
+            if ("chunked".equalsIgnoreCase(headers.get("transfer-encoding"))) {
+                body = readChunkedBody(in);
+            } else {
+                body = in.readNBytes(Integer.parseInt(headers.getOrDefault("content-length", "0")));
+            }
+            Request request = new Request(requestLine[0], requestLine[1], headers, body);
+            requests.add(request);
+
+            Response response = handler.apply(request);
+            OutputStream out = socket.getOutputStream();
+            out.write(("HTTP/1.1 200 OK\r\n"
+                    + "Content-Type: " + response.contentType + "\r\n"
+                    + "Content-Length: " + response.body.length + "\r\n"
+                    + "Cache-Control: no-store\r\n"
+                    + "Connection: close\r\n\r\n").getBytes(StandardCharsets.ISO_8859_1));
+            out.write(response.body);
+            out.flush();
+        } catch (SocketException ex) {
+            // The client went away, e.g. because the load was canceled
+        } catch (IOException ex) {
+            throw new RuntimeException(ex);
+        }
+    }
+
+    private static String readLine(InputStream in) throws IOException {
+        ByteArrayOutputStream line = new ByteArrayOutputStream();
+        for (int b = in.read(); b != '\n'; b = in.read()) {
+            if (b < 0) {
+                throw new IOException("Unexpected end of request");
+            }
+            if (b != '\r') {
+                line.write(b);
+            }
+        }
+        return line.toString(StandardCharsets.ISO_8859_1);
+    }
+
+    private static byte[] readChunkedBody(InputStream in) throws IOException {
+        ByteArrayOutputStream body = new ByteArrayOutputStream();
+        for (;;) {
+            String sizeLine = readLine(in);
+            int semicolon = sizeLine.indexOf(';');
+            int size = Integer.parseInt(
+                    semicolon < 0 ? sizeLine.trim() : sizeLine.substring(0, semicolon).trim(), 16);
+            if (size == 0) {
+                while (!readLine(in).isEmpty()) {
+                    // Skip the trailer
+                }
+                return body.toByteArray();
+            }
+            body.write(in.readNBytes(size));
+            readLine(in);
+        }
+    }
+}
@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package test.javafx.scene.web;
+
+import com.sun.webkit.TileCache;
+import com.sun.webkit.WebPage;
+import com.sun.webkit.WebPageShim;
+import com.sun.webkit.graphics.GraphicsDecoder;
+import java.awt.Color;
+import java.awt.image.BufferedImage;
+import javafx.scene.web.WebEngineShim;
+import org.junit.After;
+import org.junit.Before;
+import org.junit.Test;
+import static org.junit.Assert.assertNotNull;
+import static org.junit.Assert.assertTrue;
+
+public class RenderQueueEncodingTest extends TestBase {
+    private static final String PAGE = "<html>\n" +
+            "<body style='margin: 0px;'>\n" +
+            // 8-bit sRGB colors take the packed path.
+            "<div style='height: 100px; background-color: #c86432;'></div>\n" +
+            "<div style='height: 100px; background-color: rgba(0, 0, 255, 0.5);'></div>\n" +
+            // Colors outside of 8-bit sRGB are always sent as floats.
+            "<div style='height: 100px; background-color: color(display-p3 0.5 0.5 0.5);'></div>\n" +
+            "</body>\n" +
+            "</html>";
+
+    private long tileCacheCapacity;
+
+    @Before public void setUp() {
+        // Tiles would keep whatever has been encoded first.
+        submit(() -> {
+            tileCacheCapacity = TileCache.getCapacity();
+            TileCache.setCapacity(0);
+        });
+    }
+
+    @After public void tearDown() {
+        submit(() -> {
+            WebPageShim.setRenderQueueEncodingVersion(GraphicsDecoder.ENCODING_VERSION);
+            TileCache.setCapacity(tileCacheCapacity);
+        });
+    }
+
+    private BufferedImage paint(int encodingVersion) {
+        return submit(() -> {
+            WebPageShim.setRenderQueueEncodingVersion(encodingVersion);
+            final WebPage webPage = WebEngineShim.getPage(getEngine());
+            assertNotNull(webPage);
+            return WebPageShim.paint(webPage, 0, 0, 800, 600);
+        });
+    }
+
+    private void assertColor(BufferedImage img, int x, int y, Color expected) {
+        final Color actual = new Color(img.getRGB(x, y), true);
+        assertTrue("Color at " + x + "," + y + " should be " + expected + ": " + actual,
+                isColorsSimilar(expected, actual, 1));
+    }
+
+    /**
+     * Colors decode to the same pixels whichever encoding version they
+     * have been encoded with.
+     */
+    @Test public void testColorRoundTrip() {
+        loadContent(PAGE);
+        for (int version = GraphicsDecoder.ENCODING_VERSION_FLOAT_COLORS;
+                version <= GraphicsDecoder.ENCODING_VERSION; version++) {
+            final BufferedImage img = paint(version);
+            assertNotNull(img);
+            assertColor(img, 400, 50, new Color(200, 100, 50));
+            assertColor(img, 400, 150, new Color(127, 127, 255));
+            assertColor(img, 400, 250, new Color(128, 128, 128));
+        }
+    }
+
+    @Test public void testPackedColorsAreSmaller() {
+        final StringBuilder sb = new StringBuilder("<html><body style='margin: 0px;'>\n");
+        for (int i = 0; i < 200; i++) {
+            sb.append(String.format("<span style='background-color: #%06x; color: #%06x;'>text</span>\n",
+                    i * 0x010203, 0xffffff - i * 0x010203));
+        }
+        sb.append("</body></html>");
+        loadContent(sb.toString());
+
+        final int[] sizes = submit(() -> {
+            final WebPage webPage = WebEngineShim.getPage(getEngine());
+            WebPageShim.setRenderQueueEncodingVersion(GraphicsDecoder.ENCODING_VERSION_FLOAT_COLORS);
+            final int floatSize = WebPageShim.getRenderQueueSize(webPage, 0, 0, 800, 600);
+            WebPageShim.setRenderQueueEncodingVersion(GraphicsDecoder.ENCODING_VERSION_PACKED_COLORS);
+            final int packedSize = WebPageShim.getRenderQueueSize(webPage, 0, 0, 800, 600);
+            return new int[] { floatSize, packedSize };
+        });
+        assertTrue("Packed colors should take less space: " + sizes[1] + " vs " + sizes[0],
+                sizes[1] < sizes[0]);
+    }
+
+    /**
+     * Text runs of the same color and font set both only once, the
+     * commands repeating them are elided and counted.
+     */
+    @Test public void testRedundantStateIsElided() {
+        final StringBuilder sb = new StringBuilder("<html><body style='margin: 0px; color: #336699;'>\n");
+        for (int i = 0; i < 200; i++) {
+            sb.append("<span>text</span> <b>bold</b>\n");
+        }
+        sb.append("</body></html>");
+        loadContent(sb.toString());
+
+        final int elided = submit(() -> {
+            final WebPage webPage = WebEngineShim.getPage(getEngine());
+            WebPageShim.getRenderQueueSize(webPage, 0, 0, 800, 600);
+            return WebPageShim.getElidedCommandCount(webPage);
+        });
+        assertTrue("Repeated state commands should be elided: " + elided, elided > 0);
+    }
+}
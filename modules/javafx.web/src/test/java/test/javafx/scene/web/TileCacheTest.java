@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package test.javafx.scene.web;
+
+import com.sun.webkit.TileCache;
+import com.sun.webkit.WebPage;
+import com.sun.webkit.WebPageShim;
+import java.awt.Color;
+import java.awt.image.BufferedImage;
+import javafx.scene.web.WebEngineShim;
+import org.junit.After;
+import org.junit.Before;
+import org.junit.Test;
+import static org.junit.Assert.assertEquals;
+import static org.junit.Assert.assertTrue;
+
+public class TileCacheTest extends TestBase {
+    private static final String PAGE = "<html>\n" +
+            "<body style='margin: 0px;'>\n" +
+            "<div id='box' style='height: 100px; background-color: #ff0000;'></div>\n" +
+            "<div style='height: 100px; background-color: #00ff00;'>text</div>\n" +
+            "<div style='height: 2000px; background-color: #0000ff;'></div>\n" +
+            "</body>\n" +
+            "</html>";
+
+    private long tileCacheCapacity;
+
+    @Before public void setUp() {
+        submit(() -> {
+            tileCacheCapacity = TileCache.getCapacity();
+            TileCache.setCapacity(16 * 1024 * 1024);
+        });
+    }
+
+    @After public void tearDown() {
+        submit(() -> TileCache.setCapacity(tileCacheCapacity));
+    }
+
+    private WebPage getPage() {
+        return WebEngineShim.getPage(getEngine());
+    }
+
+    private void assertColor(BufferedImage img, int x, int y, Color expected) {
+        final Color actual = new Color(img.getRGB(x, y), true);
+        assertTrue("Color at " + x + "," + y + " should be " + expected + ": " + actual,
+                isColorsSimilar(expected, actual, 1));
+    }
+
+    private int getRenderQueueSize() {
+        return WebPageShim.getRenderQueueSize(getPage(), 0, 0, 800, 600);
+    }
+
+    /**
+     * Tiles are only painted when they are created or invalidated; clean
+     * tiles are drawn without handing any of their contents to Java again.
+     */
+    @Test public void testCleanTilesAreReused() {
+        loadContent(PAGE);
+        submit(() -> {
+            final int paintSize = getRenderQueueSize();
+            final int reuseSize = getRenderQueueSize();
+            assertTrue("Clean tiles should not be painted again: " + reuseSize + " vs " + paintSize,
+                    reuseSize < paintSize);
+            assertEquals(reuseSize, getRenderQueueSize());
+        });
+    }
+
+    @Test public void testInvalidatedTilesAreRepainted() {
+        loadContent(PAGE);
+        final int reuseSize = submit(() -> {
+            getRenderQueueSize();
+            return getRenderQueueSize();
+        });
+
+        executeScript("document.getElementById('box').style.backgroundColor = '#ffff00'");
+        submit(() -> {
+            final int repaintSize = getRenderQueueSize();
+            assertTrue("Invalidated tiles should be painted again: " + repaintSize + " vs " + reuseSize,
+                    repaintSize > reuseSize);
+
+            final BufferedImage img = WebPageShim.paint(getPage(), 0, 0, 800, 600);
+            assertColor(img, 400, 50, Color.YELLOW);
+            assertColor(img, 400, 150, Color.GREEN);
+        });
+    }
+
+    @Test public void testScrolledBackTilesAreKept() {
+        loadContent(PAGE);
+        submit(() -> {
+            WebPageShim.paint(getPage(), 0, 0, 800, 600);
+            WebPageShim.scroll(getPage(), 400, 300, 0, -10);
+            WebPageShim.paint(getPage(), 0, 0, 800, 600);
+            WebPageShim.scroll(getPage(), 400, 300, 0, 10);
+            final BufferedImage img = WebPageShim.paint(getPage(), 0, 0, 800, 600);
+            assertColor(img, 400, 50, Color.RED);
+            assertColor(img, 400, 150, Color.GREEN);
+            assertColor(img, 400, 250, Color.BLUE);
+        });
+    }
+}
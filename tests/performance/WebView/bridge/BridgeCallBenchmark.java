@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package bridge;
+
+import javafx.application.Application;
+import javafx.application.Platform;
+import javafx.concurrent.Worker;
+import javafx.scene.Scene;
+import javafx.scene.web.WebEngine;
+import javafx.scene.web.WebView;
+import javafx.stage.Stage;
+import netscape.javascript.JSObject;
+
+/**
+ * Measures the number of calls per second JavaScript can make into trivial
+ * Java methods through the WebView bridge.
+ * <p>
+ * Usage: {@code java bridge.BridgeCallBenchmark [calls]}
+ */
+public class BridgeCallBenchmark extends Application {
+
+    private static final int DEFAULT_CALLS = 200_000;
+    private static final int ARRAY_LENGTH = 1_000;
+
+    public static class Target {
+        public int add(int a, int b) {
+            return a + b;
+        }
+
+        public double sum(double[] values) {
+            double sum = 0;
+            for (double value : values) {
+                sum += value;
+            }
+            return sum;
+        }
+    }
+
+    @Override
+    public void start(Stage stage) {
+        final int calls = getParameters().getUnnamed().isEmpty()
+                ? DEFAULT_CALLS
+                : Integer.parseInt(getParameters().getUnnamed().get(0));
+
+        final WebView webView = new WebView();
+        final WebEngine engine = webView.getEngine();
+        engine.getLoadWorker().stateProperty().addListener((ov, o, n) -> {
+            if (n != Worker.State.SUCCEEDED) {
+                return;
+            }
+            JSObject window = (JSObject) engine.executeScript("window");
+            window.setMember("target", new Target());
+
+            // Warm up the bridge and the JIT before measuring.
+            run(engine, "add", calls / 10);
+            report("add(int, int)", calls, run(engine, "add", calls));
+            report("sum(double[" + ARRAY_LENGTH + "])", calls / 10, run(engine, "sum", calls / 10));
+            Platform.exit();
+        });
+        engine.loadContent("<html><script>"
+                + "function add(n) {"
+                + "  var t = performance.now();"
+                + "  for (var i = 0; i < n; i++) target.add(i, 1);"
+                + "  return performance.now() - t;"
+                + "}"
+                + "function sum(n) {"
+                + "  var values = new Array(" + ARRAY_LENGTH + ").fill(0.5);"
+                + "  var t = performance.now();"
+                + "  for (var i = 0; i < n; i++) target.sum(values);"
+                + "  return performance.now() - t;"
+                + "}"
+                + "</script></html>");
+
+        stage.setScene(new Scene(webView, 200, 100));
+        stage.show();
+    }
+
+    private static double run(WebEngine engine, String function, int calls) {
+        return ((Number) engine.executeScript(function + "(" + calls + ")")).doubleValue();
+    }
+
+    private static void report(String method, int calls, double millis) {
+        System.out.printf("%-20s %10d calls in %8.1f ms: %12.0f calls/s%n",
+                method, calls, millis, calls * 1000.0 / millis);
+    }
+
+    public static void main(String[] args) {
+        Application.launch(args);
+    }
+}
@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package bytecodecache;
+
+import java.io.File;
+import java.io.IOException;
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.util.Comparator;
+import java.util.stream.Stream;
+import javafx.application.Application;
+import javafx.application.Platform;
+import javafx.scene.Scene;
+import javafx.scene.web.WebEngine;
+import javafx.scene.web.WebView;
+import javafx.stage.Stage;
+
+/**
+ * Measures the time to first paint of a page that loads a large script,
+ * with an empty (cold) and a populated (warm) JavaScript bytecode cache.
+ * The cache lives in the directory given by the
+ * {@code com.sun.webkit.bytecodeCacheDirectory} system property and is
+ * only read back by a new process, so run the benchmark twice:
+ * <pre>
+ * java -Dcom.sun.webkit.bytecodeCacheDirectory=/tmp/jsc bytecodecache.BytecodeCacheStartupBenchmark cold
+ * java -Dcom.sun.webkit.bytecodeCacheDirectory=/tmp/jsc bytecodecache.BytecodeCacheStartupBenchmark warm
+ * </pre>
+ * The {@code cold} run empties the cache directory first.
+ */
+public class BytecodeCacheStartupBenchmark extends Application {
+
+    private static final int FUNCTIONS = 15_000;
+    // One in CALLED_FRACTION functions runs while the script loads.
+    private static final int CALLED_FRACTION = 4;
+
+    @Override
+    public void start(Stage stage) throws IOException {
+        final boolean cold = getParameters().getUnnamed().contains("cold");
+        final String cacheDirectory = System.getProperty("com.sun.webkit.bytecodeCacheDirectory");
+        if (cacheDirectory == null) {
+            System.err.println("com.sun.webkit.bytecodeCacheDirectory is not set, caching is disabled");
+        } else {
+            if (cold) {
+                deleteContents(new File(cacheDirectory).toPath());
+            }
+            Files.createDirectories(Path.of(cacheDirectory));
+        }
+
+        // The script has to be stable across runs to hit the cache.
+        final Path pageDirectory = Path.of(System.getProperty("java.io.tmpdir"), "BytecodeCacheStartupBenchmark");
+        Files.createDirectories(pageDirectory);
+        final Path script = pageDirectory.resolve("framework.js");
+        Files.writeString(script, generateScript());
+        final Path page = pageDirectory.resolve("index.html");
+        Files.writeString(page, "<html><body>"
+                + "<script src='framework.js'></script>"
+                + "<script>"
+                + "requestAnimationFrame(() => {"
+                + "  document.title = String(performance.now());"
+                + "});"
+                + "</script>"
+                + "</body></html>");
+
+        final WebView webView = new WebView();
+        final WebEngine engine = webView.getEngine();
+        engine.titleProperty().addListener((ov, o, n) -> {
+            if (n == null || n.isEmpty()) {
+                return;
+            }
+            System.out.printf("%s cache: %,d bytes of script, first paint after %8.1f ms%n",
+                    cold ? "cold" : "warm", script.toFile().length(), Double.parseDouble(n));
+            // Give the cache a moment to be written after the load finished.
+            Platform.runLater(Platform::exit);
+        });
+        engine.load(page.toUri().toString());
+
+        stage.setScene(new Scene(webView, 400, 300));
+        stage.show();
+    }
+
+    private static String generateScript() {
+        StringBuilder sb = new StringBuilder();
+        sb.append("var framework = {};\n");
+        for (int i = 0; i < FUNCTIONS; i++) {
+            sb.append("framework.f").append(i).append(" = function(a, b) {\n")
+              .append("  var result = [];\n")
+              .append("  for (var i = 0; i < a; i++) {\n")
+              .append("    result.push({ index: i, value: (i * ").append(i).append(") % (b + 1) });\n")
+              .append("  }\n")
+              .append("  return result.filter(e => e.value > ").append(i % 7).append(").length;\n")
+              .append("};\n");
+        }
+        sb.append("for (var i = 0; i < ").append(FUNCTIONS).append("; i += ").append(CALLED_FRACTION).append(") {\n")
+          .append("  framework['f' + i](2, 3);\n")
+          .append("}\n");
+        return sb.toString();
+    }
+
+    private static void deleteContents(Path directory) throws IOException {
+        if (!Files.isDirectory(directory)) {
+            return;
+        }
+        try (Stream<Path> paths = Files.walk(directory)) {
+            paths.sorted(Comparator.reverseOrder())
+                 .filter(path -> !path.equals(directory))
+                 .forEach(path -> path.toFile().delete());
+        }
+    }
+
+    public static void main(String[] args) {
+        Application.launch(args);
+    }
+}
@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package renderqueue;
+
+import java.lang.reflect.Field;
+import java.lang.reflect.Method;
+import javafx.application.Application;
+import javafx.application.Platform;
+import javafx.concurrent.Worker;
+import javafx.scene.Scene;
+import javafx.scene.web.WebEngine;
+import javafx.scene.web.WebView;
+import javafx.stage.Stage;
+
+/**
+ * Measures the number of bytes of drawing commands a color heavy page is
+ * encoded into, and the time it takes to encode them, for the render queue
+ * encoding version given by the
+ * {@code com.sun.webkit.renderQueueEncodingVersion} system property.
+ * The version is fixed for the life of the process, so run the benchmark
+ * once per version, with the tile cache disabled so that the page itself
+ * rather than cached tiles is encoded:
+ * <pre>
+ * java --add-opens javafx.web/javafx.scene.web=ALL-UNNAMED --add-opens javafx.web/com.sun.webkit=ALL-UNNAMED \
+ *      -Dcom.sun.webkit.tileCacheSize=0 -Dcom.sun.webkit.renderQueueEncodingVersion=1 renderqueue.RenderQueueSizeBenchmark
+ * java --add-opens javafx.web/javafx.scene.web=ALL-UNNAMED --add-opens javafx.web/com.sun.webkit=ALL-UNNAMED \
+ *      -Dcom.sun.webkit.tileCacheSize=0 -Dcom.sun.webkit.renderQueueEncodingVersion=2 renderqueue.RenderQueueSizeBenchmark
+ * </pre>
+ */
+public class RenderQueueSizeBenchmark extends Application {
+
+    private static final int WIDTH = 1024;
+    private static final int HEIGHT = 768;
+    private static final int ROWS = 60;
+    private static final int CELLS = 24;
+    private static final int WARMUP = 20;
+    private static final int ITERATIONS = 200;
+
+    @Override
+    public void start(Stage stage) {
+        final WebView webView = new WebView();
+        final WebEngine engine = webView.getEngine();
+        engine.getLoadWorker().stateProperty().addListener((ov, o, n) -> {
+            if (n == Worker.State.SUCCEEDED) {
+                // Let the first layout and paint settle.
+                Platform.runLater(() -> measure(engine));
+            }
+        });
+        engine.loadContent(generatePage());
+
+        stage.setScene(new Scene(webView, WIDTH, HEIGHT));
+        stage.show();
+    }
+
+    private static void measure(WebEngine engine) {
+        try {
+            final Field pageField = WebEngine.class.getDeclaredField("page");
+            pageField.setAccessible(true);
+            final Object page = pageField.get(engine);
+            final Method getRenderQueueSize = page.getClass().getDeclaredMethod(
+                    "test_getRenderQueueSize", int.class, int.class, int.class, int.class);
+            getRenderQueueSize.setAccessible(true);
+
+            int size = 0;
+            for (int i = 0; i < WARMUP; i++) {
+                size = (Integer) getRenderQueueSize.invoke(page, 0, 0, WIDTH, HEIGHT);
+            }
+            final long start = System.nanoTime();
+            for (int i = 0; i < ITERATIONS; i++) {
+                getRenderQueueSize.invoke(page, 0, 0, WIDTH, HEIGHT);
+            }
+            final double millis = (System.nanoTime() - start) / 1e6 / ITERATIONS;
+
+            System.out.printf("encoding version %s: %,d bytes per frame, encoded in %6.3f ms%n",
+                    System.getProperty("com.sun.webkit.renderQueueEncodingVersion", "(default)"),
+                    size, millis);
+        } catch (ReflectiveOperationException e) {
+            e.printStackTrace();
+        }
+        Platform.exit();
+    }
+
+    private static String generatePage() {
+        StringBuilder sb = new StringBuilder();
+        sb.append("<html><body style='margin: 0; font: 11px sans-serif;'>\n");
+        for (int row = 0; row < ROWS; row++) {
+            sb.append("<div style='white-space: nowrap;'>");
+            for (int cell = 0; cell < CELLS; cell++) {
+                final int color = (row * 7919 + cell * 104729) & 0xFFFFFF;
+                sb.append(String.format("<span style='background-color: #%06x; color: #%06x;"
+                        + " border-bottom: 1px solid #%06x;'>cell</span>",
+                        color, ~color & 0xFFFFFF, color ^ 0x808080));
+            }
+            sb.append("</div>\n");
+        }
+        sb.append("</body></html>");
+        return sb.toString();
+    }
+
+    public static void main(String[] args) {
+        Application.launch(args);
+    }
+}
@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package textrun;
+
+import javafx.application.Application;
+import javafx.application.Platform;
+import javafx.concurrent.Worker;
+import javafx.scene.Scene;
+import javafx.scene.web.WebEngine;
+import javafx.scene.web.WebView;
+import javafx.stage.Stage;
+
+/**
+ * Measures the time it takes to lay out text that goes through the complex
+ * text path (shaped scripts and text with combining marks), which fetches
+ * the glyphs of every text run from the Java font implementation.
+ * <p>
+ * Usage: {@code java textrun.ComplexTextLayoutBenchmark [iterations]}
+ */
+public class ComplexTextLayoutBenchmark extends Application {
+
+    private static final int DEFAULT_ITERATIONS = 200;
+    private static final int WARMUP = 20;
+    private static final int PARAGRAPHS = 50;
+
+    // Arabic, Devanagari and Latin with combining marks, each of which is
+    // laid out by ComplexTextController.
+    private static final String[] SAMPLES = {
+        "مرحبا بالعالم كيف حالك اليوم",
+        "नमस्ते दुनिया आप कैसे हैं",
+        "élève ñö åz̧ụr̆e",
+    };
+
+    @Override
+    public void start(Stage stage) {
+        final String param = getParameters().getUnnamed().isEmpty()
+                ? null : getParameters().getUnnamed().get(0);
+        final int iterations = param == null ? DEFAULT_ITERATIONS : Integer.parseInt(param);
+
+        final WebView webView = new WebView();
+        final WebEngine engine = webView.getEngine();
+        engine.getLoadWorker().stateProperty().addListener((ov, o, n) -> {
+            if (n == Worker.State.SUCCEEDED) {
+                Platform.runLater(() -> measure(engine, iterations));
+            }
+        });
+        engine.loadContent(generatePage());
+
+        stage.setScene(new Scene(webView, 800, 600));
+        stage.show();
+    }
+
+    private static void measure(WebEngine engine, int iterations) {
+        // Changing the font size invalidates the cached widths, so every
+        // run is shaped again by the forced layout.
+        final String layout = "(function(n) {"
+                + "  var body = document.body, height = 0;"
+                + "  for (var i = 0; i < n; i++) {"
+                + "    body.style.fontSize = (12 + i % 8) + 'px';"
+                + "    height += body.offsetHeight;"
+                + "  }"
+                + "  return height;"
+                + "})";
+        engine.executeScript(layout + "(" + WARMUP + ")");
+
+        final long start = System.nanoTime();
+        engine.executeScript(layout + "(" + iterations + ")");
+        final double millis = (System.nanoTime() - start) / 1e6;
+
+        System.out.printf("%d layouts of %d complex text paragraphs: %8.1f ms, %6.3f ms per layout%n",
+                iterations, PARAGRAPHS, millis, millis / iterations);
+        Platform.exit();
+    }
+
+    private static String generatePage() {
+        StringBuilder sb = new StringBuilder();
+        sb.append("<html><body style='width: 760px;'>\n");
+        for (int i = 0; i < PARAGRAPHS; i++) {
+            final String sample = SAMPLES[i % SAMPLES.length];
+            sb.append("<p").append(i % SAMPLES.length == 0 ? " dir='rtl'>" : ">");
+            for (int j = 0; j < 8; j++) {
+                sb.append(sample).append(' ');
+            }
+            sb.append("</p>\n");
+        }
+        sb.append("</body></html>");
+        return sb.toString();
+    }
+
+    public static void main(String[] args) {
+        Application.launch(args);
+    }
+}